@@ -0,0 +1,208 @@
+/*
+ *  regbl - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+    # include "common-change.hpp"
+
+/*
+    source - Change methods
+ */
+
+    void lc_change_compute( lc_store_t const & lc_old, lc_store_t const & lc_new, std::vector< lc_change_t > & lc_change ) {
+
+        /* store index */
+        uint64_t lc_i( 0 );
+        uint64_t lc_j( 0 );
+
+        /* points count */
+        uint64_t lc_count( 0 );
+
+        /* modification flag */
+        bool lc_modify( false );
+
+        /* reset changes */
+        lc_change.clear();
+
+        /* merging stores */
+        while ( ( lc_i < lc_old.st_count ) || ( lc_j < lc_new.st_count ) ) {
+
+            /* check removed building */
+            if ( ( lc_j == lc_new.st_count ) || ( ( lc_i < lc_old.st_count ) && ( lc_old.st_egid[lc_i] < lc_new.st_egid[lc_j] ) ) ) {
+
+                /* push change */
+                lc_change.push_back( { lc_old.st_egid[lc_i ++], LC_CHANGE_REMOVE } );
+
+            } else
+            if ( ( lc_i == lc_old.st_count ) || ( lc_new.st_egid[lc_j] < lc_old.st_egid[lc_i] ) ) {
+
+                /* push change */
+                lc_change.push_back( { lc_new.st_egid[lc_j ++], LC_CHANGE_ADD } );
+
+            } else {
+
+                /* retrieve points count */
+                lc_count = lc_store_get_count( lc_new, lc_j );
+
+                /* compare building information */
+                lc_modify = ( lc_store_get_count( lc_old, lc_i ) != lc_count ) || ( lc_old.st_reference[lc_i] != lc_new.st_reference[lc_j] ) || ( lc_old.st_surface[lc_i] != lc_new.st_surface[lc_j] );
+
+                /* parsing years */
+                for ( uint32_t lc_year = 0; ( lc_year < lc_new.st_years ) && ( lc_modify == false ); lc_year ++ ) {
+
+                    /* compare building points */
+                    lc_modify = std::memcmp( lc_store_get_position( lc_old, lc_year, lc_i ), lc_store_get_position( lc_new, lc_year, lc_j ), lc_count * 2 * sizeof( int32_t ) ) != 0;
+
+                }
+
+                /* check modification */
+                if ( lc_modify == true ) {
+
+                    /* push change */
+                    lc_change.push_back( { lc_new.st_egid[lc_j], LC_CHANGE_MODIFY } );
+
+                }
+
+                /* update index */
+                lc_i ++;
+                lc_j ++;
+
+            }
+
+        }
+
+    }
+
+    bool lc_change_export( std::string const lc_path, std::vector< lc_change_t > const & lc_change ) {
+
+        /* output stream */
+        std::ofstream lc_stream( lc_path, std::ofstream::out );
+
+        /* check stream */
+        if ( lc_stream.is_open() == false ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* parsing changes */
+        for ( lc_change_t const & lc_entry : lc_change ) {
+
+            /* export change */
+            lc_stream << lc_entry.ch_egid << " " << lc_entry.ch_type << "\n";
+
+        }
+
+        /* delete stream */
+        lc_stream.close();
+
+        /* send message */
+        return( lc_stream.fail() == false );
+
+    }
+
+    bool lc_change_import( std::string const lc_path, std::vector< lc_change_t > & lc_change ) {
+
+        /* importation buffer */
+        lc_change_t lc_entry;
+
+        /* input stream */
+        std::ifstream lc_stream( lc_path, std::ifstream::in );
+
+        /* reset changes */
+        lc_change.clear();
+
+        /* check stream */
+        if ( lc_stream.is_open() == false ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* parsing changes file */
+        while ( lc_stream >> lc_entry.ch_egid >> lc_entry.ch_type ) {
+
+            /* push change */
+            lc_change.push_back( lc_entry );
+
+        }
+
+        /* send message */
+        return( lc_stream.eof() == true );
+
+    }
+
+    void lc_change_merge( std::vector< lc_change_t > const & lc_pending, std::vector< lc_change_t > const & lc_change, std::vector< lc_change_t > & lc_merge ) {
+
+        /* lists index */
+        size_t lc_i( 0 );
+        size_t lc_j( 0 );
+
+        /* reset merged changes */
+        lc_merge.clear();
+
+        /* merging lists */
+        while ( ( lc_i < lc_pending.size() ) || ( lc_j < lc_change.size() ) ) {
+
+            /* check pending change only */
+            if ( ( lc_j == lc_change.size() ) || ( ( lc_i < lc_pending.size() ) && ( lc_pending[lc_i].ch_egid < lc_change[lc_j].ch_egid ) ) ) {
+
+                /* push change */
+                lc_merge.push_back( lc_pending[lc_i ++] );
+
+            } else
+            if ( ( lc_i == lc_pending.size() ) || ( lc_change[lc_j].ch_egid < lc_pending[lc_i].ch_egid ) ) {
+
+                /* push change */
+                lc_merge.push_back( lc_change[lc_j ++] );
+
+            } else {
+
+                /* check newer change type */
+                if ( lc_change[lc_j].ch_type == LC_CHANGE_REMOVE ) {
+
+                    /* push change - building removed */
+                    lc_merge.push_back( { lc_change[lc_j].ch_egid, LC_CHANGE_REMOVE } );
+
+                } else
+                if ( lc_pending[lc_i].ch_type == LC_CHANGE_ADD ) {
+
+                    /* push change - building still added */
+                    lc_merge.push_back( { lc_change[lc_j].ch_egid, LC_CHANGE_ADD } );
+
+                } else {
+
+                    /* push change - building present before and after */
+                    lc_merge.push_back( { lc_change[lc_j].ch_egid, LC_CHANGE_MODIFY } );
+
+                }
+
+                /* update index */
+                lc_i ++;
+                lc_j ++;
+
+            }
+
+        }
+
+    }
+
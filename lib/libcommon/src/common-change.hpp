@@ -0,0 +1,167 @@
+/*
+ *  regbl - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+    /*! \file   common-change.hpp
+     *  \author Nils Hamel <nils.hamel@alumni.epfl.ch>
+     *  \author Huriel Reichel
+     *
+     *  regbl - common library - change
+     */
+
+/*
+    header - inclusion guard
+ */
+
+    # ifndef __LC_CHANGE__
+    # define __LC_CHANGE__
+
+/*
+    header - internal includes
+ */
+
+    # include "common-store.hpp"
+
+/*
+    header - external includes
+ */
+
+    # include <iostream>
+    # include <fstream>
+    # include <string>
+    # include <vector>
+    # include <cstdint>
+    # include <cstring>
+
+/*
+    header - preprocessor definitions
+ */
+
+    /* define change types */
+    # define LC_CHANGE_ADD    ( 'A' )
+    # define LC_CHANGE_REMOVE ( 'R' )
+    # define LC_CHANGE_MODIFY ( 'M' )
+
+/*
+    header - preprocessor macros
+ */
+
+/*
+    header - type definition
+ */
+
+/*
+    header - structures
+ */
+
+    /*! \struct lc_change_struct
+     *  \brief Change structure
+     *
+     *  This structure describes the change of a building between two building
+     *  stores, typically computed from two releases of the RegBL database. A
+     *  building can be added, removed or modified, the latter covering the
+     *  change of its points, construction date or surface.
+     *
+     *  \var lc_change_struct::ch_egid
+     *  Building EGID
+     *  \var lc_change_struct::ch_type
+     *  Change type, LC_CHANGE_ADD, LC_CHANGE_REMOVE or LC_CHANGE_MODIFY
+     */
+
+    typedef struct lc_change_struct {
+
+        int64_t ch_egid;
+        char    ch_type;
+
+    } lc_change_t;
+
+/*
+    header - function prototypes
+ */
+
+    /*! \brief Change methods
+     *
+     * This function compares two building stores sharing the same years and
+     * computes the list of changes needed to go from the first one to the
+     * second one. As both stores are sorted on EGID, they are compared in a
+     * single merging pass, the changes list being itself sorted on EGID.
+     *
+     * A building present in both stores is considered as modified as soon as
+     * its amount of points, one of its points on any year, its construction
+     * date or its surface differs.
+     *
+     * \param lc_old    Previous building store
+     * \param lc_new    Updated building store
+     * \param lc_change Changes list
+     */
+
+    void lc_change_compute( lc_store_t const & lc_old, lc_store_t const & lc_new, std::vector< lc_change_t > & lc_change );
+
+    /*! \brief Change methods
+     *
+     * This function exports the provided changes list in a text file, each
+     * line containing the EGID of the building followed by its change type.
+     *
+     * \param lc_path   Path of the changes file
+     * \param lc_change Changes list
+     *
+     * \return Returns true on success, false otherwise.
+     */
+
+    bool lc_change_export( std::string const lc_path, std::vector< lc_change_t > const & lc_change );
+
+    /*! \brief Change methods
+     *
+     * This function imports a changes list exported by lc_change_export(). The
+     * content of the provided list is replaced.
+     *
+     * \param lc_path   Path of the changes file
+     * \param lc_change Changes list
+     *
+     * \return Returns true on success, false otherwise.
+     */
+
+    bool lc_change_import( std::string const lc_path, std::vector< lc_change_t > & lc_change );
+
+    /*! \brief Change methods
+     *
+     * This function merges a pending changes list, not yet processed by the
+     * subsequent processes, with the changes list of a newer update, both
+     * being sorted on EGID. The merged list, also sorted on EGID, goes from
+     * the store of the pending list to the store of the newer one.
+     *
+     * A building found in both lists is removed if the newer list removes it.
+     * A building removed and added again is modified, while a building added
+     * and modified again stays added. Otherwise, it is modified.
+     *
+     * \param lc_pending Pending changes list
+     * \param lc_change  Newer changes list
+     * \param lc_merge   Merged changes list
+     */
+
+    void lc_change_merge( std::vector< lc_change_t > const & lc_pending, std::vector< lc_change_t > const & lc_change, std::vector< lc_change_t > & lc_merge );
+
+/*
+    header - inclusion guard
+ */
+
+    # endif
+
@@ -27,21 +27,106 @@
 
     unsigned int lc_connect_get_size( cv::Mat & lc_image, cv::Mat & lc_mask, int const lc_x, int const lc_y, bool const lc_erase ) {
 
-        /* compute connected area */
-        lc_connect_t lc_area = lc_connect_get( lc_image, lc_mask, lc_x, lc_y, lc_erase );
+        /* runs buffer - reused across calls */
+        static thread_local std::vector< lc_connect_span_t > lc_span;
+
+        /* array head */
+        size_t lc_head( 0 );
+
+        /* pixels count */
+        unsigned int lc_size( 0 );
+
+        /* run boundaries */
+        int lc_l( lc_x );
+        int lc_r( lc_x );
+
+        /* rows pointers */
+        uchar const * lc_pixel( lc_image.ptr<uchar>( lc_y ) );
+        uchar * lc_track( lc_mask.ptr<uchar>( lc_y ) );
+
+        /* reset buffer */
+        lc_span.clear();
+
+        /* extend initial run */
+        while ( ( lc_l > 0 ) && ( lc_track[lc_l - 1] == 0 ) && ( lc_pixel[lc_l - 1] == 0 ) ) lc_l --;
+        while ( ( lc_r < lc_image.cols - 1 ) && ( lc_track[lc_r + 1] == 0 ) && ( lc_pixel[lc_r + 1] == 0 ) ) lc_r ++;
+
+        /* update mask */
+        std::fill( lc_track + lc_l, lc_track + lc_r + 1, 255 );
+
+        /* push initial run */
+        lc_span.push_back( { lc_l, lc_r, lc_y } );
+
+        /* follow connected runs */
+        while ( lc_head < lc_span.size() ) {
+
+            /* extract run */
+            lc_connect_span_t lc_run( lc_span[lc_head ++] );
+
+            /* update count */
+            lc_size += lc_run.sp_x1 - lc_run.sp_x0 + 1;
+
+            /* parsing neighbour rows */
+            for ( int lc_v = lc_run.sp_y - 1; lc_v <= lc_run.sp_y + 1; lc_v += 2 ) {
+
+                /* check coordinates */
+                if ( ( lc_v < 0 ) || ( lc_v >= lc_image.rows ) ) continue;
+
+                /* rows pointers */
+                lc_pixel = lc_image.ptr<uchar>( lc_v );
+                lc_track = lc_mask.ptr<uchar>( lc_v );
+
+                /* parsing run extent */
+                for ( int lc_u = lc_run.sp_x0; lc_u <= lc_run.sp_x1; lc_u ++ ) {
+
+                    /* check mask and pixel value */
+                    if ( ( lc_track[lc_u] != 0 ) || ( lc_pixel[lc_u] != 0 ) ) continue;
+
+                    /* run boundaries */
+                    lc_l = lc_u;
+                    lc_r = lc_u;
+
+                    /* extend run */
+                    while ( ( lc_l > 0 ) && ( lc_track[lc_l - 1] == 0 ) && ( lc_pixel[lc_l - 1] == 0 ) ) lc_l --;
+                    while ( ( lc_r < lc_image.cols - 1 ) && ( lc_track[lc_r + 1] == 0 ) && ( lc_pixel[lc_r + 1] == 0 ) ) lc_r ++;
+
+                    /* update mask */
+                    std::fill( lc_track + lc_l, lc_track + lc_r + 1, 255 );
+
+                    /* push connected run */
+                    lc_span.push_back( { lc_l, lc_r, lc_v } );
+
+                    /* continue after run */
+                    lc_u = lc_r;
+
+                }
+
+            }
+
+        }
+
+        /* check erase option */
+        if ( lc_erase == true ) {
+
+            /* parsing runs */
+            for ( lc_connect_span_t const & lc_run : lc_span ) {
+
+                /* erase mask run */
+                std::fill( lc_mask.ptr<uchar>( lc_run.sp_y ) + lc_run.sp_x0, lc_mask.ptr<uchar>( lc_run.sp_y ) + lc_run.sp_x1 + 1, 0 );
+
+            }
+
+        }
 
         /* return connected part size */
-        return( lc_area.size() );
+        return( lc_size );
 
     }
 
-    lc_connect_t lc_connect_get( cv::Mat & lc_image, cv::Mat & lc_mask, int const lc_x, int const lc_y, bool const lc_erase ) {
-
-        /* retruned structure */
-        lc_connect_t lc_connect;
+    unsigned int lc_connect_get( cv::Mat & lc_image, cv::Mat & lc_mask, int const lc_x, int const lc_y, bool const lc_erase, lc_connect_t & lc_connect ) {
 
         /* array head */
-        unsigned int lc_head( 0 );
+        size_t lc_head( 0 );
 
         /* detection coordinates */
         int lc_u( 0 );
@@ -50,12 +135,11 @@
         /* connected neighbour */
         int lc_neigh[4][2] = { { +1, +0 }, { -1, +0 }, { +0, +1 }, { +0, -1 } };
 
-        /* pushing first element */
-        lc_connect.push_back( std::vector< int > ( 2 ) );
+        /* reset structure - capacity kept */
+        lc_connect.clear();
 
-        /* assign first element */
-        lc_connect.back()[0] = lc_x;
-        lc_connect.back()[1] = lc_y;
+        /* push first element */
+        lc_connect.push_back( { lc_x, lc_y } );
 
         /* update mask */
         lc_mask.at<uchar>(lc_y, lc_x) = 255;
@@ -67,8 +151,8 @@
             for ( unsigned int lc_i = 0; lc_i < 4; lc_i ++ ) {
 
                 /* compose detection coordinates */
-                lc_u = lc_connect[lc_head][0] + lc_neigh[lc_i][0];
-                lc_v = lc_connect[lc_head][1] + lc_neigh[lc_i][1];
+                lc_u = lc_connect[lc_head].cp_x + lc_neigh[lc_i][0];
+                lc_v = lc_connect[lc_head].cp_y + lc_neigh[lc_i][1];
 
                 /* check coordinates */
                 if ( ( lc_u < 0 ) || ( lc_v < 0 ) ) continue;
@@ -83,11 +167,7 @@
                     if ( lc_image.at<uchar>( lc_v, lc_u ) == 0 ) {
 
                         /* push connected element */
-                        lc_connect.push_back( std::vector< int > ( 2 ) );
-
-                        /* assign connected element */
-                        lc_connect.back()[0] = lc_u;
-                        lc_connect.back()[1] = lc_v;
+                        lc_connect.push_back( { lc_u, lc_v } );
 
                         /* update mask */
                         lc_mask.at<uchar>( lc_v, lc_u ) = 255;
@@ -107,17 +187,17 @@
         if ( lc_erase == true ) {
 
             /* parsing connected array */
-            for ( unsigned int lc_i = 0; lc_i < lc_connect.size(); lc_i ++ ) {
+            for ( lc_connect_point_t const & lc_point : lc_connect ) {
 
                 /* erase mask pixel */
-                lc_mask.at<uchar>( lc_connect[lc_i][1], lc_connect[lc_i][0] ) = 0;
+                lc_mask.at<uchar>( lc_point.cp_y, lc_point.cp_x ) = 0;
 
             }
 
         }
 
-        /* return structure */
-        return( lc_connect );
+        /* return connected part size */
+        return( lc_connect.size() );
 
     }
 
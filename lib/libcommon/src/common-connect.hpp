@@ -43,6 +43,8 @@
 
     # include <iostream>
     # include <vector>
+    # include <cstdint>
+    # include <algorithm>
     # include <opencv2/core/core.hpp>
     # include <opencv2/highgui/highgui.hpp>
     # include <opencv2/imgproc/imgproc.hpp>
@@ -59,25 +61,81 @@
     header - type definition
  */
 
-    typedef std::vector < std::vector < int > > lc_connect_t;
-
 /*
     header - structures
  */
 
+    /*! \struct lc_connect_point_struct
+     *  \brief Connected pixel structure
+     *
+     *  This structure holds the coordinates of a pixel selected as part of a
+     *  connected area.
+     *
+     *  \var lc_connect_point_struct::cp_x
+     *  Pixel position, in column
+     *  \var lc_connect_point_struct::cp_y
+     *  Pixel position, in row
+     */
+
+    typedef struct lc_connect_point_struct {
+
+        int32_t cp_x;
+        int32_t cp_y;
+
+    } lc_connect_point_t;
+
+    /*! \struct lc_connect_span_struct
+     *  \brief Connected span structure
+     *
+     *  This structure holds an horizontal run of pixels selected as part of a
+     *  connected area. The run covers the columns between sp_x0 and sp_x1, both
+     *  included, on the row sp_y.
+     *
+     *  \var lc_connect_span_struct::sp_x0
+     *  Run first column
+     *  \var lc_connect_span_struct::sp_x1
+     *  Run last column
+     *  \var lc_connect_span_struct::sp_y
+     *  Run row
+     */
+
+    typedef struct lc_connect_span_struct {
+
+        int32_t sp_x0;
+        int32_t sp_x1;
+        int32_t sp_y;
+
+    } lc_connect_span_t;
+
+    /* connected area structure - flat pixels array */
+    typedef std::vector < lc_connect_point_t > lc_connect_t;
+
 /*
     header - function prototypes
  */
 
     /*! \brief Connectivity methods
      *
-     * This function is a simple front-end to the lc_connect_get() function. It
-     * only uses the returned connected structure to extract it size, in pixels
-     * count and returns it.
+     * This function computes the size, in pixels count, of the connected area
+     * starting at the provided pixel, following the same rules as the function
+     * lc_connect_get(), but without materialising the pixels coordinates.
+     *
+     * The area is followed by horizontal runs : each run is extended to the
+     * left and to the right as far as possible, and the rows above and below
+     * are then scanned over the run extent to find the next ones. Only the
+     * runs are stored, in a per-thread buffer that is reused from one call to
+     * the other, which avoids any allocation once the buffer has grown to the
+     * size of the largest area met.
      *
      * lc_image and lc_mask : single channel image
      * lc_mask needs to be zero-valued
      *
+     * \param lc_image Source image, single-channel binary image {0,255}
+     * \param lc_mask  Tracking image, single-channel binary image {0,255}
+     * \param lc_x     Initial pixel position
+     * \param lc_y     Initial pixel position
+     * \param lc_erase Trakcer image erasing flag
+     *
      * \return Size, in pixels, of the connected area.
      */
 
@@ -92,8 +150,10 @@
      *
      * The process implements a simple neighbour searh of black pixel starting
      * by the provided one, until the entire area is converted. The coordinates
-     * of each found black pixel are pushed, in x, y order, to the connect
-     * return structure, which is a simple vector of ints vector.
+     * of each found black pixel are pushed to the provided connect structure,
+     * which is a flat vector of pixel structures. The structure is cleared by
+     * the function before to be filled, keeping its capacity, so that a caller
+     * can reuse the same structure for successive calls without allocation.
      *
      * The function uses a secondary image, also a single-channel binary image
      * with same size as the image one, that it uses to keep track of the
@@ -106,17 +166,17 @@
      * be set to true to ask the function to erase all the update it made on the
      * seconary image, to keep it in its original state.
      * 
-     * \param lc_image Source image, single-channel binary image {0,255}
-     * \param lc_mask  Tracking image, single-channel binary image {0,255}
-     * \param lc_x     Initial pixel position
-     * \param lc_y     Initial pixel position
-     * \param lc_erase Trakcer image erasing flag
+     * \param lc_image   Source image, single-channel binary image {0,255}
+     * \param lc_mask    Tracking image, single-channel binary image {0,255}
+     * \param lc_x       Initial pixel position
+     * \param lc_y       Initial pixel position
+     * \param lc_erase   Trakcer image erasing flag
+     * \param lc_connect Connect structure receiving the selected pixels
      *
-     * \return Returns vector of int vector (n by 2) containing the selected
-     * pixel coordinates.
+     * \return Size, in pixels, of the connected area.
      */
 
-    lc_connect_t lc_connect_get( cv::Mat & lc_image, cv::Mat & lc_mask, int const lc_x, int const lc_y, bool const lc_erase );
+    unsigned int lc_connect_get( cv::Mat & lc_image, cv::Mat & lc_mask, int const lc_x, int const lc_y, bool const lc_erase, lc_connect_t & lc_connect );
 
 /*
     header - inclusion guard
@@ -0,0 +1,390 @@
+/*
+ *  regbl - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+    # include "common-cube.hpp"
+
+/*
+    source - Cube methods
+ */
+
+    bool lc_cube_open( std::string const lc_path, lc_cube_t & lc_cube ) {
+
+        /* file descriptor */
+        int lc_file( -1 );
+
+        /* file status */
+        struct stat lc_stat;
+
+        /* header pointer */
+        lc_cube_header_t const * lc_header( NULL );
+
+        /* reset structure */
+        lc_cube = lc_cube_t();
+
+        /* open file */
+        if ( ( lc_file = open( lc_path.c_str(), O_RDONLY ) ) < 0 ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* retrieve file size */
+        if ( ( fstat( lc_file, & lc_stat ) != 0 ) || ( size_t( lc_stat.st_size ) < sizeof( lc_cube_header_t ) ) ) {
+
+            /* delete descriptor */
+            close( lc_file );
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* map file */
+        lc_cube.cb_base = mmap( NULL, lc_stat.st_size, PROT_READ, MAP_SHARED, lc_file, 0 );
+
+        /* delete descriptor - mapping kept */
+        close( lc_file );
+
+        /* check mapping */
+        if ( lc_cube.cb_base == MAP_FAILED ) {
+
+            /* reset structure */
+            lc_cube = lc_cube_t();
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* assign mapping size */
+        lc_cube.cb_size = lc_stat.st_size;
+
+        /* assign header */
+        lc_header = ( lc_cube_header_t const * ) lc_cube.cb_base;
+
+        /* check signature and version */
+        if ( ( std::memcmp( lc_header->bh_magic, LC_CUBE_MAGIC, 8 ) != 0 ) || ( lc_header->bh_version != LC_CUBE_VERSION ) ) {
+
+            /* release mapping */
+            lc_cube_close( lc_cube );
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* assign dimensions */
+        lc_cube.cb_years  = lc_header->bh_years;
+        lc_cube.cb_width  = lc_header->bh_width;
+        lc_cube.cb_height = lc_header->bh_height;
+        lc_cube.cb_word   = lc_header->bh_word;
+
+        /* check words size and size consistency */
+        if ( ( lc_cube.cb_years > LC_CUBE_YEARS ) || ( lc_cube.cb_word != ( ( lc_cube.cb_years > 16 ) ? 4 : 2 ) ) || ( lc_cube.cb_size != sizeof( lc_cube_header_t ) + size_t( lc_cube.cb_width ) * lc_cube.cb_height * lc_cube.cb_word ) ) {
+
+            /* release mapping */
+            lc_cube_close( lc_cube );
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* assign arrays */
+        lc_cube.cb_year = lc_header->bh_year;
+        lc_cube.cb_cols = lc_header->bh_cols;
+        lc_cube.cb_rows = lc_header->bh_rows;
+        lc_cube.cb_data = ( char const * ) lc_cube.cb_base + sizeof( lc_cube_header_t );
+
+        /* parsing years */
+        for ( uint32_t lc_parse = 0; lc_parse < lc_cube.cb_years; lc_parse ++ ) {
+
+            /* check map size */
+            if ( ( lc_cube.cb_cols[lc_parse] < 0 ) || ( uint32_t( lc_cube.cb_cols[lc_parse] ) > lc_cube.cb_width ) || ( lc_cube.cb_rows[lc_parse] < 0 ) || ( uint32_t( lc_cube.cb_rows[lc_parse] ) > lc_cube.cb_height ) ) {
+
+                /* release mapping */
+                lc_cube_close( lc_cube );
+
+                /* send message */
+                return( false );
+
+            }
+
+        }
+
+        /* send message */
+        return( true );
+
+    }
+
+    void lc_cube_close( lc_cube_t & lc_cube ) {
+
+        /* check mapping */
+        if ( lc_cube.cb_base != NULL ) {
+
+            /* release mapping */
+            munmap( lc_cube.cb_base, lc_cube.cb_size );
+
+        }
+
+        /* reset structure */
+        lc_cube = lc_cube_t();
+
+    }
+
+    bool lc_cube_check( lc_cube_t const & lc_cube, lc_list_t & lc_list ) {
+
+        /* check years count */
+        if ( lc_cube.cb_years != lc_list.size() ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* parsing years */
+        for ( uint32_t lc_parse = 0; lc_parse < lc_cube.cb_years; lc_parse ++ ) {
+
+            /* check year */
+            if ( lc_cube.cb_year[lc_parse] != lc_list[lc_parse].fr_year ) {
+
+                /* send message */
+                return( false );
+
+            }
+
+            /* check map size */
+            if ( ( lc_list[lc_parse].fr_width != lc_cube.cb_cols[lc_parse] ) || ( lc_list[lc_parse].fr_height != lc_cube.cb_rows[lc_parse] ) ) {
+
+                /* send message */
+                return( false );
+
+            }
+
+        }
+
+        /* send message */
+        return( true );
+
+    }
+
+    void lc_cube_get_map( lc_cube_t const & lc_cube, uint32_t const lc_index, cv::Mat & lc_map ) {
+
+        /* year bit mask */
+        uint32_t lc_mask( uint32_t( 1 ) << lc_index );
+
+        /* allocate map */
+        lc_map = cv::Mat( cv::Size( lc_cube.cb_cols[lc_index], lc_cube.cb_rows[lc_index] ), CV_8UC1 );
+
+        /* parsing rows */
+        for ( int lc_y = 0; lc_y < lc_map.rows; lc_y ++ ) {
+
+            /* row pointer */
+            uchar * lc_row( lc_map.ptr<uchar>( lc_y ) );
+
+            /* check words size */
+            if ( lc_cube.cb_word == 2 ) {
+
+                /* words row pointer */
+                uint16_t const * lc_word( ( uint16_t const * ) lc_cube.cb_data + size_t( lc_y ) * lc_cube.cb_width );
+
+                /* parsing columns */
+                for ( int lc_x = 0; lc_x < lc_map.cols; lc_x ++ ) {
+
+                    /* extract year pixel */
+                    lc_row[lc_x] = ( lc_word[lc_x] & lc_mask ) ? 0 : 255;
+
+                }
+
+            } else {
+
+                /* words row pointer */
+                uint32_t const * lc_word( ( uint32_t const * ) lc_cube.cb_data + size_t( lc_y ) * lc_cube.cb_width );
+
+                /* parsing columns */
+                for ( int lc_x = 0; lc_x < lc_map.cols; lc_x ++ ) {
+
+                    /* extract year pixel */
+                    lc_row[lc_x] = ( lc_word[lc_x] & lc_mask ) ? 0 : 255;
+
+                }
+
+            }
+
+        }
+
+    }
+
+    void lc_cube_pack( cv::Mat const & lc_map, std::vector< uint8_t > & lc_plane ) {
+
+        /* pixel index */
+        size_t lc_pixel( 0 );
+
+        /* allocate and clear bit-plane */
+        lc_plane.assign( ( size_t( lc_map.cols ) * lc_map.rows + 7 ) / 8, 0 );
+
+        /* parsing rows */
+        for ( int lc_y = 0; lc_y < lc_map.rows; lc_y ++ ) {
+
+            /* row pointer */
+            uchar const * lc_row( lc_map.ptr<uchar>( lc_y ) );
+
+            /* parsing columns */
+            for ( int lc_x = 0; lc_x < lc_map.cols; lc_x ++, lc_pixel ++ ) {
+
+                /* set bit of black pixel */
+                if ( lc_row[lc_x] == 0 ) lc_plane[lc_pixel >> 3] |= uint8_t( 1 ) << ( lc_pixel & 7 );
+
+            }
+
+        }
+
+    }
+
+    bool lc_cube_write( std::string const lc_path, lc_list_t & lc_list, std::vector< std::vector< uint8_t > > const & lc_plane ) {
+
+        /* file header */
+        lc_cube_header_t lc_header;
+
+        /* cube size */
+        size_t lc_width( 0 ), lc_height( 0 );
+
+        /* words row */
+        std::vector< uint16_t > lc_short;
+        std::vector< uint32_t > lc_long;
+
+        /* output stream */
+        std::ofstream lc_stream;
+
+        /* check years count */
+        if ( ( lc_list.size() == 0 ) || ( lc_list.size() > LC_CUBE_YEARS ) || ( lc_plane.size() != lc_list.size() ) ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* compose header */
+        std::memset( & lc_header, 0, sizeof( lc_cube_header_t ) );
+        std::memcpy( lc_header.bh_magic, LC_CUBE_MAGIC, 8 );
+
+        /* compose header */
+        lc_header.bh_version = LC_CUBE_VERSION;
+        lc_header.bh_years = lc_list.size();
+        lc_header.bh_word = ( lc_list.size() > 16 ) ? 4 : 2;
+
+        /* parsing years */
+        for ( size_t lc_parse = 0; lc_parse < lc_list.size(); lc_parse ++ ) {
+
+            /* check map and bit-plane size */
+            if ( ( lc_list[lc_parse].fr_width < 0 ) || ( lc_list[lc_parse].fr_height < 0 ) || ( lc_plane[lc_parse].size() != ( size_t( lc_list[lc_parse].fr_width ) * lc_list[lc_parse].fr_height + 7 ) / 8 ) ) {
+
+                /* send message */
+                return( false );
+
+            }
+
+            /* assign year and map size */
+            lc_header.bh_year[lc_parse] = lc_list[lc_parse].fr_year;
+            lc_header.bh_cols[lc_parse] = lc_list[lc_parse].fr_width;
+            lc_header.bh_rows[lc_parse] = lc_list[lc_parse].fr_height;
+
+            /* update cube size */
+            lc_width  = std::max( lc_width , size_t( lc_list[lc_parse].fr_width  ) );
+            lc_height = std::max( lc_height, size_t( lc_list[lc_parse].fr_height ) );
+
+        }
+
+        /* assign cube size */
+        lc_header.bh_width = lc_width;
+        lc_header.bh_height = lc_height;
+
+        /* create output stream */
+        lc_stream.open( lc_path, std::ofstream::out | std::ofstream::binary );
+
+        /* check output stream */
+        if ( lc_stream.is_open() == false ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* export header */
+        lc_stream.write( ( char const * ) & lc_header, sizeof( lc_cube_header_t ) );
+
+        /* allocate words row */
+        if ( lc_header.bh_word == 2 ) lc_short.resize( lc_width ); else lc_long.resize( lc_width );
+
+        /* parsing rows */
+        for ( size_t lc_y = 0; lc_y < lc_height; lc_y ++ ) {
+
+            /* parsing columns */
+            for ( size_t lc_x = 0; lc_x < lc_width; lc_x ++ ) {
+
+                /* pixel word */
+                uint32_t lc_word( 0 );
+
+                /* parsing years */
+                for ( size_t lc_parse = 0; lc_parse < lc_plane.size(); lc_parse ++ ) {
+
+                    /* check pixel on year map */
+                    if ( ( lc_x >= size_t( lc_header.bh_cols[lc_parse] ) ) || ( lc_y >= size_t( lc_header.bh_rows[lc_parse] ) ) ) continue;
+
+                    /* compute year map pixel index */
+                    size_t lc_pixel( lc_y * lc_header.bh_cols[lc_parse] + lc_x );
+
+                    /* gather year bit */
+                    lc_word |= uint32_t( ( lc_plane[lc_parse][lc_pixel >> 3] >> ( lc_pixel & 7 ) ) & 1 ) << lc_parse;
+
+                }
+
+                /* assign pixel word */
+                if ( lc_header.bh_word == 2 ) lc_short[lc_x] = lc_word; else lc_long[lc_x] = lc_word;
+
+            }
+
+            /* export words row */
+            if ( lc_header.bh_word == 2 ) {
+
+                /* export short words */
+                lc_stream.write( ( char const * ) lc_short.data(), lc_width * sizeof( uint16_t ) );
+
+            } else {
+
+                /* export long words */
+                lc_stream.write( ( char const * ) lc_long.data(), lc_width * sizeof( uint32_t ) );
+
+            }
+
+        }
+
+        /* delete output stream */
+        lc_stream.close();
+
+        /* send message */
+        return( lc_stream.good() );
+
+    }
+
@@ -0,0 +1,270 @@
+/*
+ *  regbl - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+    /*! \file   common-cube.hpp
+     *  \author Nils Hamel <nils.hamel@alumni.epfl.ch>
+     *  \author Huriel Reichel
+     *
+     *  regbl - common library - cube
+     */
+
+/*
+    header - inclusion guard
+ */
+
+    # ifndef __LC_CUBE__
+    # define __LC_CUBE__
+
+/*
+    header - internal includes
+ */
+
+    # include "common-list.hpp"
+
+/*
+    header - external includes
+ */
+
+    # include <iostream>
+    # include <fstream>
+    # include <string>
+    # include <vector>
+    # include <cstdint>
+    # include <cstring>
+    # include <algorithm>
+    # include <sys/mman.h>
+    # include <sys/stat.h>
+    # include <fcntl.h>
+    # include <unistd.h>
+    # include <opencv2/core/core.hpp>
+
+/*
+    header - preprocessor definitions
+ */
+
+    /* define cube signature */
+    # define LC_CUBE_MAGIC   "REGBLCUB"
+
+    /* define cube format version */
+    # define LC_CUBE_VERSION ( 1 )
+
+    /* define maximum number of years */
+    # define LC_CUBE_YEARS   ( 32 )
+
+/*
+    header - preprocessor macros
+ */
+
+/*
+    header - type definition
+ */
+
+/*
+    header - structures
+ */
+
+    /*! \struct lc_cube_header_struct
+     *  \brief Cube file header
+     *
+     *  This structure gives the layout of the header found at the beginning of
+     *  a cube file. It is followed by the words array, holding one word per
+     *  pixel of the cube, row by row. The bit i of a word is set when the pixel
+     *  is black (building) on the map of the year of index i, the years being
+     *  given in the order of the 3D raster descriptor.
+     *
+     *  The cube covers the largest map, each map occupying the top-left corner
+     *  of the cube with its own size. The words are 16 bits wide up to 16
+     *  years and 32 bits wide beyond. The cube is only a compact source of the
+     *  segmented maps, each map being extracted by lc_cube_get_map().
+     *
+     *  \var lc_cube_header_struct::bh_magic
+     *  Cube file signature
+     *  \var lc_cube_header_struct::bh_version
+     *  Cube format version
+     *  \var lc_cube_header_struct::bh_years
+     *  Number of years (3D raster slices)
+     *  \var lc_cube_header_struct::bh_width
+     *  Cube width, in pixels
+     *  \var lc_cube_header_struct::bh_height
+     *  Cube height, in pixels
+     *  \var lc_cube_header_struct::bh_word
+     *  Words size, in bytes
+     *  \var lc_cube_header_struct::bh_reserved
+     *  Reserved, zero
+     *  \var lc_cube_header_struct::bh_year
+     *  Years of the 3D raster slices, zero beyond the number of years
+     *  \var lc_cube_header_struct::bh_cols
+     *  Maps width, in pixels, zero beyond the number of years
+     *  \var lc_cube_header_struct::bh_rows
+     *  Maps height, in pixels, zero beyond the number of years
+     */
+
+    typedef struct lc_cube_header_struct {
+
+        char     bh_magic[8];
+        uint32_t bh_version;
+        uint32_t bh_years;
+        uint32_t bh_width;
+        uint32_t bh_height;
+        uint32_t bh_word;
+        uint32_t bh_reserved;
+        int32_t  bh_year[LC_CUBE_YEARS];
+        int32_t  bh_cols[LC_CUBE_YEARS];
+        int32_t  bh_rows[LC_CUBE_YEARS];
+
+    } lc_cube_header_t;
+
+    /*! \struct lc_cube_struct
+     *  \brief Cube structure
+     *
+     *  This structure holds a memory-mapped cube file along with a pointer on
+     *  its words array. It is filled by the lc_cube_open() function and
+     *  released by the lc_cube_close() one.
+     *
+     *  \var lc_cube_struct::cb_base
+     *  Mapping base address
+     *  \var lc_cube_struct::cb_size
+     *  Mapping size, in bytes
+     *  \var lc_cube_struct::cb_years
+     *  Number of years
+     *  \var lc_cube_struct::cb_width
+     *  Cube width, in pixels
+     *  \var lc_cube_struct::cb_height
+     *  Cube height, in pixels
+     *  \var lc_cube_struct::cb_word
+     *  Words size, in bytes
+     *  \var lc_cube_struct::cb_year
+     *  Years of the 3D raster slices
+     *  \var lc_cube_struct::cb_cols
+     *  Maps width, in pixels
+     *  \var lc_cube_struct::cb_rows
+     *  Maps height, in pixels
+     *  \var lc_cube_struct::cb_data
+     *  Words array
+     */
+
+    typedef struct lc_cube_struct {
+
+        void *          cb_base;
+        size_t          cb_size;
+
+        uint32_t        cb_years;
+        uint32_t        cb_width;
+        uint32_t        cb_height;
+        uint32_t        cb_word;
+
+        int32_t const * cb_year;
+        int32_t const * cb_cols;
+        int32_t const * cb_rows;
+        void const *    cb_data;
+
+    } lc_cube_t;
+
+/*
+    header - function prototypes
+ */
+
+    /*! \brief Cube methods
+     *
+     * This function maps the provided cube file in memory and sets the pointers
+     * of the cube structure. The file header is checked for its signature, its
+     * version and its size consistency.
+     *
+     * \param lc_path Path of the cube file
+     * \param lc_cube Cube structure
+     *
+     * \return Returns true on success, false otherwise.
+     */
+
+    bool lc_cube_open( std::string const lc_path, lc_cube_t & lc_cube );
+
+    /*! \brief Cube methods
+     *
+     * This function releases the memory mapping of the provided cube and
+     * resets its structure.
+     *
+     * \param lc_cube Cube structure
+     */
+
+    void lc_cube_close( lc_cube_t & lc_cube );
+
+    /*! \brief Cube methods
+     *
+     * This function checks that the years of the cube are the same, and in the
+     * same order, as the ones of the provided 3D raster descriptor, and that
+     * the size of each map matches the size given for its year.
+     *
+     * \param lc_cube Cube structure
+     * \param lc_list 3D raster descriptor
+     *
+     * \return Returns true if consistent, false otherwise.
+     */
+
+    bool lc_cube_check( lc_cube_t const & lc_cube, lc_list_t & lc_list );
+
+    /*! \brief Cube methods
+     *
+     * This function extracts the map of the designated year index from the
+     * cube. The map is a one channel image, of the size of the year map, in
+     * which the black pixels are set to 0 and the other ones to 255, as the
+     * segmented maps.
+     *
+     * \param lc_cube  Cube structure
+     * \param lc_index Year index
+     * \param lc_map   Extracted map
+     */
+
+    void lc_cube_get_map( lc_cube_t const & lc_cube, uint32_t const lc_index, cv::Mat & lc_map );
+
+    /*! \brief Cube methods
+     *
+     * This function packs the black pixels of the provided segmented map in a
+     * bit-plane, one bit per pixel row by row, the bit being set for a black
+     * pixel. The bit-planes of all years are then gathered by lc_cube_write().
+     *
+     * \param lc_map   Segmented map, expected to be a one channel image
+     * \param lc_plane Bit-plane
+     */
+
+    void lc_cube_pack( cv::Mat const & lc_map, std::vector< uint8_t > & lc_plane );
+
+    /*! \brief Cube methods
+     *
+     * This function writes a cube file using the provided 3D raster descriptor
+     * and the bit-planes of its years, computed by lc_cube_pack() and given in
+     * the descriptor order. The cube size is the one of the largest map.
+     *
+     * \param lc_path  Path of the cube file
+     * \param lc_list  3D raster descriptor
+     * \param lc_plane Bit-planes, one per year
+     *
+     * \return Returns true on success, false otherwise.
+     */
+
+    bool lc_cube_write( std::string const lc_path, lc_list_t & lc_list, std::vector< std::vector< uint8_t > > const & lc_plane );
+
+/*
+    header - inclusion guard
+ */
+
+    # endif
+
@@ -0,0 +1,172 @@
+/*
+ *  regbl - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+    # include "common-grid.hpp"
+
+/*
+    source - Grid methods
+ */
+
+    void lc_grid_create( lc_grid_t & lc_grid, std::vector< lc_bound_t > const & lc_bound ) {
+
+        /* union bounding box */
+        lc_bound_t lc_union = { + INFINITY, - INFINITY, + INFINITY, - INFINITY };
+
+        /* cells range */
+        int64_t lc_x0( 0 ), lc_x1( 0 );
+        int64_t lc_y0( 0 ), lc_y1( 0 );
+
+        /* reset grid */
+        lc_grid = lc_grid_t();
+
+        /* parsing bounding boxes */
+        for ( lc_bound_t const & lc_box : lc_bound ) {
+
+            /* extend union */
+            lc_union.bd_xmin = std::min( lc_union.bd_xmin, lc_box.bd_xmin );
+            lc_union.bd_xmax = std::max( lc_union.bd_xmax, lc_box.bd_xmax );
+            lc_union.bd_ymin = std::min( lc_union.bd_ymin, lc_box.bd_ymin );
+            lc_union.bd_ymax = std::max( lc_union.bd_ymax, lc_box.bd_ymax );
+
+        }
+
+        /* check union - empty grid */
+        if ( ( lc_union.bd_xmin > lc_union.bd_xmax ) || ( lc_union.bd_ymin > lc_union.bd_ymax ) ) {
+
+            /* empty grid offsets */
+            lc_grid.gd_offset.assign( 1, 0 );
+
+            /* abort */
+            return;
+
+        }
+
+        /* compute cell size - bounded amount of cells */
+        lc_grid.gd_cell = std::max( LC_GRID_CELL, std::max( lc_union.bd_xmax - lc_union.bd_xmin, lc_union.bd_ymax - lc_union.bd_ymin ) / LC_GRID_SIDE );
+
+        /* assign grid origin */
+        lc_grid.gd_xmin = lc_union.bd_xmin;
+        lc_grid.gd_ymin = lc_union.bd_ymin;
+
+        /* compute grid size */
+        lc_grid.gd_width  = int64_t( ( lc_union.bd_xmax - lc_union.bd_xmin ) / lc_grid.gd_cell ) + 1;
+        lc_grid.gd_height = int64_t( ( lc_union.bd_ymax - lc_union.bd_ymin ) / lc_grid.gd_cell ) + 1;
+
+        /* allocate offsets */
+        lc_grid.gd_offset.assign( lc_grid.gd_width * lc_grid.gd_height + 1, 0 );
+
+        /* counting and filling passes */
+        for ( int lc_pass = 0; lc_pass < 2; lc_pass ++ ) {
+
+            /* check filling pass */
+            if ( lc_pass == 1 ) {
+
+                /* convert counts into offsets */
+                for ( size_t lc_cell = 1; lc_cell < lc_grid.gd_offset.size(); lc_cell ++ ) {
+
+                    /* accumulate counts */
+                    lc_grid.gd_offset[lc_cell] += lc_grid.gd_offset[lc_cell - 1];
+
+                }
+
+                /* allocate lists */
+                lc_grid.gd_item.resize( lc_grid.gd_offset.back() );
+
+            }
+
+            /* parsing bounding boxes */
+            for ( uint32_t lc_index = 0; lc_index < lc_bound.size(); lc_index ++ ) {
+
+                /* compute cells range */
+                lc_x0 = int64_t( ( lc_bound[lc_index].bd_xmin - lc_grid.gd_xmin ) / lc_grid.gd_cell );
+                lc_x1 = int64_t( ( lc_bound[lc_index].bd_xmax - lc_grid.gd_xmin ) / lc_grid.gd_cell );
+                lc_y0 = int64_t( ( lc_bound[lc_index].bd_ymin - lc_grid.gd_ymin ) / lc_grid.gd_cell );
+                lc_y1 = int64_t( ( lc_bound[lc_index].bd_ymax - lc_grid.gd_ymin ) / lc_grid.gd_cell );
+
+                /* parsing cells */
+                for ( int64_t lc_y = lc_y0; lc_y <= lc_y1; lc_y ++ ) {
+
+                    /* parsing cells */
+                    for ( int64_t lc_x = lc_x0; lc_x <= lc_x1; lc_x ++ ) {
+
+                        /* check pass */
+                        if ( lc_pass == 0 ) {
+
+                            /* count cell item - shifted for offsets */
+                            lc_grid.gd_offset[lc_y * lc_grid.gd_width + lc_x + 1] ++;
+
+                        } else {
+
+                            /* push cell item */
+                            lc_grid.gd_item[lc_grid.gd_offset[lc_y * lc_grid.gd_width + lc_x] ++] = lc_index;
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        /* restore offsets - shifted by the filling pass */
+        for ( size_t lc_cell = lc_grid.gd_offset.size() - 1; lc_cell > 0; lc_cell -- ) {
+
+            /* shift offset */
+            lc_grid.gd_offset[lc_cell] = lc_grid.gd_offset[lc_cell - 1];
+
+        }
+
+        /* first offset */
+        lc_grid.gd_offset[0] = 0;
+
+    }
+
+    uint32_t lc_grid_find( lc_grid_t const & lc_grid, double const lc_x, double const lc_y, uint32_t const * & lc_item ) {
+
+        /* cell coordinates */
+        double lc_u( ( lc_x - lc_grid.gd_xmin ) / lc_grid.gd_cell );
+        double lc_v( ( lc_y - lc_grid.gd_ymin ) / lc_grid.gd_cell );
+
+        /* cell index */
+        int64_t lc_cell( 0 );
+
+        /* check coordinates - false on non-finite values */
+        if ( ( ( lc_u >= 0. ) && ( lc_u < lc_grid.gd_width ) && ( lc_v >= 0. ) && ( lc_v < lc_grid.gd_height ) ) == false ) {
+
+            /* empty list */
+            return( 0 );
+
+        }
+
+        /* compute cell index */
+        lc_cell = int64_t( lc_v ) * lc_grid.gd_width + int64_t( lc_u );
+
+        /* assign cell list */
+        lc_item = lc_grid.gd_item.data() + lc_grid.gd_offset[lc_cell];
+
+        /* return list size */
+        return( lc_grid.gd_offset[lc_cell + 1] - lc_grid.gd_offset[lc_cell] );
+
+    }
+
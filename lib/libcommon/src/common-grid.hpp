@@ -0,0 +1,154 @@
+/*
+ *  regbl - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+    /*! \file   common-grid.hpp
+     *  \author Nils Hamel <nils.hamel@alumni.epfl.ch>
+     *  \author Huriel Reichel
+     *
+     *  regbl - common library - grid
+     */
+
+/*
+    header - inclusion guard
+ */
+
+    # ifndef __LC_GRID__
+    # define __LC_GRID__
+
+/*
+    header - internal includes
+ */
+
+    # include "common-list.hpp"
+
+/*
+    header - external includes
+ */
+
+    # include <iostream>
+    # include <vector>
+    # include <cstdint>
+    # include <cmath>
+    # include <algorithm>
+
+/*
+    header - preprocessor definitions
+ */
+
+    /* define minimal cell size - metres */
+    # define LC_GRID_CELL ( 1000.0 )
+
+    /* define maximal amount of cells per side */
+    # define LC_GRID_SIDE ( 1024 )
+
+/*
+    header - preprocessor macros
+ */
+
+/*
+    header - type definition
+ */
+
+/*
+    header - structures
+ */
+
+    /*! \struct lc_grid_struct
+     *  \brief Grid index structure
+     *
+     *  This structure holds a coarse regular grid covering the union of a set
+     *  of bounding boxes. Each cell lists, in increasing order, the indexes of
+     *  the bounding boxes overlapping it, allowing to quickly find the boxes
+     *  that can contain a given point. The lists of the cells are stored one
+     *  after the other, the offset array giving the beginning of the list of
+     *  each cell, row by row.
+     *
+     *  \var lc_grid_struct::gd_xmin
+     *  Grid origin, easting
+     *  \var lc_grid_struct::gd_ymin
+     *  Grid origin, northing
+     *  \var lc_grid_struct::gd_cell
+     *  Cell size, in metres
+     *  \var lc_grid_struct::gd_width
+     *  Amount of cells, easting
+     *  \var lc_grid_struct::gd_height
+     *  Amount of cells, northing
+     *  \var lc_grid_struct::gd_offset
+     *  Offset of each cell list, plus the total size
+     *  \var lc_grid_struct::gd_item
+     *  Cells lists of bounding boxes indexes
+     */
+
+    typedef struct lc_grid_struct {
+
+        double                  gd_xmin;
+        double                  gd_ymin;
+        double                  gd_cell;
+
+        int64_t                 gd_width;
+        int64_t                 gd_height;
+
+        std::vector< uint32_t > gd_offset;
+        std::vector< uint32_t > gd_item;
+
+    } lc_grid_t;
+
+/*
+    header - function prototypes
+ */
+
+    /*! \brief Grid methods
+     *
+     * This function creates the grid index of the provided bounding boxes. The
+     * cell size is LC_GRID_CELL, enlarged if needed to keep the amount of cells
+     * per side below LC_GRID_SIDE. Each bounding box is then listed in all the
+     * cells it overlaps.
+     *
+     * \param lc_grid  Grid structure
+     * \param lc_bound Bounding boxes array
+     */
+
+    void lc_grid_create( lc_grid_t & lc_grid, std::vector< lc_bound_t > const & lc_bound );
+
+    /*! \brief Grid methods
+     *
+     * This function returns the list of the bounding boxes overlapping the cell
+     * containing the provided point. As the cells are coarse, the point still
+     * has to be checked against each listed bounding box. Non-finite points
+     * and points outside of the grid give an empty list.
+     *
+     * \param lc_grid Grid structure
+     * \param lc_x    Easting coordinate
+     * \param lc_y    Northing coordinate
+     * \param lc_item Returned pointer on the cell list
+     *
+     * \return Returns the amount of bounding boxes of the cell list.
+     */
+
+    uint32_t lc_grid_find( lc_grid_t const & lc_grid, double const lc_x, double const lc_y, uint32_t const * & lc_item );
+
+/*
+    header - inclusion guard
+ */
+
+    # endif
+
@@ -0,0 +1,157 @@
+/*
+ *  regbl - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+    # include "common-hash.hpp"
+
+/*
+    source - Hash methods
+ */
+
+    uint64_t lc_hash_mix( uint64_t lc_key ) {
+
+        /* splitmix64 finaliser */
+        lc_key = ( lc_key ^ ( lc_key >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+        lc_key = ( lc_key ^ ( lc_key >> 27 ) ) * 0x94d049bb133111ebULL;
+
+        /* return mixed key */
+        return( lc_key ^ ( lc_key >> 31 ) );
+
+    }
+
+    void lc_hash_create( lc_hash_t & lc_hash, size_t const lc_count ) {
+
+        /* table capacity */
+        size_t lc_size( LC_HASH_BASE );
+
+        /* keep table at most half full */
+        while ( lc_size < lc_count * 2 ) lc_size <<= 1;
+
+        /* allocate slots */
+        lc_hash.hs_key.assign( lc_size, 0 );
+        lc_hash.hs_value.assign( lc_size, LC_HASH_NONE );
+
+        /* reset count */
+        lc_hash.hs_count = 0;
+
+    }
+
+    uint64_t lc_hash_find( lc_hash_t const & lc_hash, int64_t const lc_key ) {
+
+        /* slot mask */
+        size_t lc_mask( lc_hash.hs_key.size() - 1 );
+
+        /* initial slot */
+        size_t lc_slot( lc_hash_mix( lc_key ) & lc_mask );
+
+        /* check table */
+        if ( lc_hash.hs_key.empty() == true ) {
+
+            /* send message */
+            return( LC_HASH_NONE );
+
+        }
+
+        /* probing slots */
+        while ( lc_hash.hs_value[lc_slot] != LC_HASH_NONE ) {
+
+            /* check key */
+            if ( lc_hash.hs_key[lc_slot] == lc_key ) {
+
+                /* return value */
+                return( lc_hash.hs_value[lc_slot] );
+
+            }
+
+            /* next slot */
+            lc_slot = ( lc_slot + 1 ) & lc_mask;
+
+        }
+
+        /* send message */
+        return( LC_HASH_NONE );
+
+    }
+
+    void lc_hash_insert( lc_hash_t & lc_hash, int64_t const lc_key, uint64_t const lc_value ) {
+
+        /* resizing table */
+        lc_hash_t lc_grow;
+
+        /* slot mask */
+        size_t lc_mask( 0 );
+
+        /* probing slot */
+        size_t lc_slot( 0 );
+
+        /* check table load */
+        if ( ( lc_hash.hs_count + 1 ) * 2 > lc_hash.hs_key.size() ) {
+
+            /* create doubled table */
+            lc_hash_create( lc_grow, lc_hash.hs_count + 1 );
+
+            /* parsing slots */
+            for ( size_t lc_parse = 0; lc_parse < lc_hash.hs_key.size(); lc_parse ++ ) {
+
+                /* re-insert used slots */
+                if ( lc_hash.hs_value[lc_parse] != LC_HASH_NONE ) lc_hash_insert( lc_grow, lc_hash.hs_key[lc_parse], lc_hash.hs_value[lc_parse] );
+
+            }
+
+            /* swap tables */
+            std::swap( lc_hash, lc_grow );
+
+        }
+
+        /* compute slot mask */
+        lc_mask = lc_hash.hs_key.size() - 1;
+
+        /* initial slot */
+        lc_slot = lc_hash_mix( lc_key ) & lc_mask;
+
+        /* probing slots */
+        while ( lc_hash.hs_value[lc_slot] != LC_HASH_NONE ) {
+
+            /* check key */
+            if ( lc_hash.hs_key[lc_slot] == lc_key ) {
+
+                /* replace value */
+                lc_hash.hs_value[lc_slot] = lc_value;
+
+                /* abort insertion */
+                return;
+
+            }
+
+            /* next slot */
+            lc_slot = ( lc_slot + 1 ) & lc_mask;
+
+        }
+
+        /* assign slot */
+        lc_hash.hs_key[lc_slot] = lc_key;
+        lc_hash.hs_value[lc_slot] = lc_value;
+
+        /* update count */
+        lc_hash.hs_count ++;
+
+    }
+
@@ -0,0 +1,155 @@
+/*
+ *  regbl - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+    /*! \file   common-hash.hpp
+     *  \author Nils Hamel <nils.hamel@alumni.epfl.ch>
+     *  \author Huriel Reichel
+     *
+     *  regbl - common library - hash
+     */
+
+/*
+    header - inclusion guard
+ */
+
+    # ifndef __LC_HASH__
+    # define __LC_HASH__
+
+/*
+    header - internal includes
+ */
+
+/*
+    header - external includes
+ */
+
+    # include <iostream>
+    # include <vector>
+    # include <cstdint>
+
+/*
+    header - preprocessor definitions
+ */
+
+    /* define empty slot and missing key value */
+    # define LC_HASH_NONE ( UINT64_MAX )
+
+    /* define initial capacity */
+    # define LC_HASH_BASE ( 1024 )
+
+/*
+    header - preprocessor macros
+ */
+
+/*
+    header - type definition
+ */
+
+/*
+    header - structures
+ */
+
+    /*! \struct lc_hash_struct
+     *  \brief Hash table structure
+     *
+     *  This structure holds an open-addressing hash table associating EGID to
+     *  index values. The slots are probed linearly starting at the slot given
+     *  by the mixed key. An empty slot is identified by the LC_HASH_NONE value.
+     *  The capacity is always a power of two and the table is doubled as soon
+     *  as it becomes half full.
+     *
+     *  \var lc_hash_struct::hs_key
+     *  Slots keys
+     *  \var lc_hash_struct::hs_value
+     *  Slots values, LC_HASH_NONE for empty slots
+     *  \var lc_hash_struct::hs_count
+     *  Number of used slots
+     */
+
+    typedef struct lc_hash_struct {
+
+        std::vector< int64_t  > hs_key;
+        std::vector< uint64_t > hs_value;
+
+        size_t                  hs_count;
+
+    } lc_hash_t;
+
+/*
+    header - function prototypes
+ */
+
+    /*! \brief Hash methods
+     *
+     * This function mixes the bits of the provided key using the splitmix64
+     * finaliser. The result is stable across runs and platforms.
+     *
+     * \param lc_key Key value
+     *
+     * \return Returns the mixed key.
+     */
+
+    uint64_t lc_hash_mix( uint64_t lc_key );
+
+    /*! \brief Hash methods
+     *
+     * This function initialises the provided hash table with a capacity able
+     * to hold the provided amount of keys without being resized.
+     *
+     * \param lc_hash  Hash table structure
+     * \param lc_count Expected amount of keys
+     */
+
+    void lc_hash_create( lc_hash_t & lc_hash, size_t const lc_count );
+
+    /*! \brief Hash methods
+     *
+     * This function searches the provided key in the hash table.
+     *
+     * \param lc_hash Hash table structure
+     * \param lc_key  Key value
+     *
+     * \return Returns the value associated to the key, LC_HASH_NONE if the key
+     * is not in the table.
+     */
+
+    uint64_t lc_hash_find( lc_hash_t const & lc_hash, int64_t const lc_key );
+
+    /*! \brief Hash methods
+     *
+     * This function associates the provided value to the provided key. The
+     * value is replaced if the key is already in the table. The table is
+     * doubled before the insertion if it becomes half full.
+     *
+     * \param lc_hash  Hash table structure
+     * \param lc_key   Key value
+     * \param lc_value Value, different from LC_HASH_NONE
+     */
+
+    void lc_hash_insert( lc_hash_t & lc_hash, int64_t const lc_key, uint64_t const lc_value );
+
+/*
+    header - inclusion guard
+ */
+
+    # endif
+
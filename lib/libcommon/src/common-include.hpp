@@ -49,8 +49,16 @@
  */
 
     # include "common-args.hpp"
+    # include "common-change.hpp"
     # include "common-connect.hpp"
+    # include "common-cube.hpp"
+    # include "common-grid.hpp"
+    # include "common-hash.hpp"
     # include "common-list.hpp"
+    # include "common-mark.hpp"
+    # include "common-shard.hpp"
+    # include "common-store.hpp"
+    # include "common-tsv.hpp"
 
 /*
     header - external includes
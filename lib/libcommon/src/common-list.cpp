@@ -31,7 +31,7 @@
         lc_list_t lc_return;
 
         /* importation buffer */
-        std::vector < std::string > lc_buffer(7);
+        lc_frame_t lc_buffer;
 
         /* create stream */
         std::ifstream lc_stream( lc_path, std::ifstream::in );
@@ -45,7 +45,17 @@
         }
 
         /* parsing list file */
-        while ( lc_stream >> lc_buffer[0] >> lc_buffer[1] >> lc_buffer[2] >> lc_buffer[3] >> lc_buffer[4] >> lc_buffer[5] >> lc_buffer[6] ) {
+        while ( lc_stream >> lc_buffer.fr_name >> lc_buffer.fr_xmin >> lc_buffer.fr_xmax >> lc_buffer.fr_ymin >> lc_buffer.fr_ymax >> lc_buffer.fr_width >> lc_buffer.fr_height ) {
+
+            /* convert year */
+            lc_buffer.fr_year = std::atoi( lc_buffer.fr_name.c_str() );
+
+            /* compute ranges */
+            lc_buffer.fr_xrange = lc_buffer.fr_xmax - lc_buffer.fr_xmin;
+            lc_buffer.fr_yrange = lc_buffer.fr_ymax - lc_buffer.fr_ymin;
+
+            /* compute metric to pixel factor */
+            lc_buffer.fr_factor = double( lc_buffer.fr_width ) / lc_buffer.fr_xrange;
 
             /* push buffer to list */
             lc_return.push_back( lc_buffer );
@@ -66,12 +76,75 @@
 
     double lc_list_metric_to_pixel( lc_list_t & lc_list, int const lc_index ) {
 
-        /* range values */
-        double lc_georange( std::stod( lc_list[lc_index][2] ) - std::stod( lc_list[lc_index][1] ) );
-        double lc_pixrange( std::stod( lc_list[lc_index][5] ) );
+        /* return factor */
+        return( lc_list[lc_index].fr_factor );
+
+    }
+
+    bool lc_frame_transform( lc_frame_t const & lc_frame, double const lc_x, double const lc_y, int32_t & lc_u, int32_t & lc_v ) {
+
+        /* convert coordinate according to map */
+        lc_u = std::round( ( ( lc_x - lc_frame.fr_xmin ) / lc_frame.fr_xrange ) * lc_frame.fr_width );
+
+        /* convert coordinate according to map - rows from the top of the map */
+        lc_v = lc_frame.fr_height - 1 - std::round( ( ( lc_y - lc_frame.fr_ymin ) / lc_frame.fr_yrange ) * lc_frame.fr_height );
+
+        /* check coordinates */
+        return( ( lc_u >= 0 ) && ( lc_u < lc_frame.fr_width ) && ( lc_v >= 0 ) && ( lc_v < lc_frame.fr_height ) );
+
+    }
+
+    size_t lc_list_transform( lc_list_t const & lc_list, double const lc_x, double const lc_y, int32_t * const lc_position ) {
+
+        /* selection count */
+        size_t lc_count( 0 );
+
+        /* parsing frames */
+        for ( size_t lc_parse = 0; lc_parse < lc_list.size(); lc_parse ++ ) {
+
+            /* convert coordinates and update count */
+            lc_count += lc_frame_transform( lc_list[lc_parse], lc_x, lc_y, lc_position[lc_parse * 2], lc_position[lc_parse * 2 + 1] ) ? 1 : 0;
+
+        }
+
+        /* return selection count */
+        return( lc_count );
+
+    }
+
+    lc_bound_t lc_list_bound( lc_list_t const & lc_list ) {
+
+        /* returned bound - empty */
+        lc_bound_t lc_bound = { + INFINITY, - INFINITY, + INFINITY, - INFINITY };
+
+        /* pixel size */
+        double lc_xpixel( 0. );
+        double lc_ypixel( 0. );
+
+        /* parsing frames */
+        for ( lc_frame_t const & lc_frame : lc_list ) {
+
+            /* compute pixel size */
+            lc_xpixel = std::fabs( lc_frame.fr_xrange / lc_frame.fr_width );
+            lc_ypixel = std::fabs( lc_frame.fr_yrange / lc_frame.fr_height );
+
+            /* extend bound - one pixel margin */
+            lc_bound.bd_xmin = std::min( lc_bound.bd_xmin, std::min( lc_frame.fr_xmin, lc_frame.fr_xmax ) - lc_xpixel );
+            lc_bound.bd_xmax = std::max( lc_bound.bd_xmax, std::max( lc_frame.fr_xmin, lc_frame.fr_xmax ) + lc_xpixel );
+            lc_bound.bd_ymin = std::min( lc_bound.bd_ymin, std::min( lc_frame.fr_ymin, lc_frame.fr_ymax ) - lc_ypixel );
+            lc_bound.bd_ymax = std::max( lc_bound.bd_ymax, std::max( lc_frame.fr_ymin, lc_frame.fr_ymax ) + lc_ypixel );
+
+        }
+
+        /* return bound */
+        return( lc_bound );
+
+    }
+
+    bool lc_bound_inside( lc_bound_t const & lc_bound, double const lc_x, double const lc_y ) {
 
-        /* compute and return factor */
-        return( lc_pixrange / lc_georange );
+        /* check coordinates - false on non-finite values */
+        return( ( lc_x >= lc_bound.bd_xmin ) && ( lc_x <= lc_bound.bd_xmax ) && ( lc_y >= lc_bound.bd_ymin ) && ( lc_y <= lc_bound.bd_ymax ) );
 
     }
 
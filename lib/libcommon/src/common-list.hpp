@@ -45,6 +45,10 @@
     # include <fstream>
     # include <string>
     # include <vector>
+    # include <cmath>
+    # include <cstdint>
+    # include <cstdlib>
+    # include <algorithm>
 
 /*
     header - preprocessor definitions
@@ -58,12 +62,89 @@
     header - type definition
  */
 
-    typedef std::vector < std::vector< std::string > > lc_list_t;
-
 /*
     header - structures
  */
 
+    /*! \struct lc_frame_struct
+     *  \brief Frame descriptor structure
+     *
+     *  This structure holds the description of a slice of the 3D raster as
+     *  given by a line of the descriptor file, converted once at importation.
+     *  The ranges used by the EPSG:2056 to pixel transform and the metric to
+     *  pixel factor are also computed at importation.
+     *
+     *  \var lc_frame_struct::fr_name
+     *  Year token, as found in the descriptor, used to name the maps
+     *  \var lc_frame_struct::fr_year
+     *  Year of the slice
+     *  \var lc_frame_struct::fr_xmin
+     *  Geographical boundary, easting
+     *  \var lc_frame_struct::fr_xmax
+     *  Geographical boundary, easting
+     *  \var lc_frame_struct::fr_ymin
+     *  Geographical boundary, northing
+     *  \var lc_frame_struct::fr_ymax
+     *  Geographical boundary, northing
+     *  \var lc_frame_struct::fr_width
+     *  Map width, in pixels
+     *  \var lc_frame_struct::fr_height
+     *  Map height, in pixels
+     *  \var lc_frame_struct::fr_xrange
+     *  Geographical range, easting
+     *  \var lc_frame_struct::fr_yrange
+     *  Geographical range, northing
+     *  \var lc_frame_struct::fr_factor
+     *  Metric to pixel conversion factor
+     */
+
+    typedef struct lc_frame_struct {
+
+        std::string fr_name;
+        int         fr_year;
+
+        double      fr_xmin;
+        double      fr_xmax;
+        double      fr_ymin;
+        double      fr_ymax;
+
+        int         fr_width;
+        int         fr_height;
+
+        double      fr_xrange;
+        double      fr_yrange;
+        double      fr_factor;
+
+    } lc_frame_t;
+
+    /* 3D raster descriptor - one frame per slice */
+    typedef std::vector < lc_frame_t > lc_list_t;
+
+    /*! \struct lc_bound_struct
+     *  \brief Geographical bound structure
+     *
+     *  This structure holds a geographical bounding box, in EPSG:2056, used to
+     *  quickly reject coordinates that can not appear on any slice.
+     *
+     *  \var lc_bound_struct::bd_xmin
+     *  Geographical boundary, easting
+     *  \var lc_bound_struct::bd_xmax
+     *  Geographical boundary, easting
+     *  \var lc_bound_struct::bd_ymin
+     *  Geographical boundary, northing
+     *  \var lc_bound_struct::bd_ymax
+     *  Geographical boundary, northing
+     */
+
+    typedef struct lc_bound_struct {
+
+        double bd_xmin;
+        double bd_xmax;
+        double bd_ymin;
+        double bd_ymax;
+
+    } lc_bound_t;
+
 /*
     header - function prototypes
  */
@@ -79,13 +160,13 @@
      * year, geographical boundaries and map pixel size of each slice of the
      * 3D raster.
      *
-     * This function allows to simply import the content of the descriptor in a
-     * vector of string vector, each line containing a slice description.
+     * This function imports the content of the descriptor in a vector of frame
+     * structures, each of them describing a slice. The values are converted at
+     * importation, along with the ranges and factor used by the transforms.
      *
      * \param lc_path Path of the 3D raster descriptor file
      *
-     * \return Returns a vector of string vector containing the content of the
-     * descriptor file in a n by 7 matrix, n being the amount of slices.
+     * \return Returns a vector of frame structures, one per slice.
      */
 
     lc_list_t lc_list_import( std::string const lc_path );
@@ -94,9 +175,9 @@
      *
      * This function allows to compute the conversion factor to apply on metric
      * value to obtain their pixel counterpart on the map designated by a line
-     * of the provdied 3D raster descriptor string matrix.
+     * of the provdied 3D raster descriptor.
      *
-     * \param lc_list  3D raster descriptor string matrix
+     * \param lc_list  3D raster descriptor
      * \param lc_index Index of the slide in the 3D raster descriptor
      *
      * \return Returns the metric to pixel conversion factor of the designated
@@ -105,6 +186,81 @@
 
     double lc_list_metric_to_pixel( lc_list_t & lc_list, int const lc_index );
 
+    /*! \brief Conversion methods
+     *
+     * This function converts the provided EPSG:2056 coordinates into pixel
+     * coordinates on the map described by the provided frame. The pixel
+     * coordinates are computed as :
+     *
+     *     u = round( ( ( x - xmin ) / ( xmax - xmin ) ) * width )
+     *     v = height - 1 - round( ( ( y - ymin ) / ( ymax - ymin ) ) * height )
+     *
+     * The rows are then counted from the top of the map, as in the map images,
+     * so that the maps and overlays can be used as read, without flipping
+     * them.
+     *
+     * \param lc_frame Frame descriptor
+     * \param lc_x     Easting coordinate
+     * \param lc_y     Northing coordinate
+     * \param lc_u     Returned pixel coordinate
+     * \param lc_v     Returned pixel coordinate
+     *
+     * \return Returns true if the pixel is on the map, false otherwise.
+     */
+
+    bool lc_frame_transform( lc_frame_t const & lc_frame, double const lc_x, double const lc_y, int32_t & lc_u, int32_t & lc_v );
+
+    /*! \brief Conversion methods
+     *
+     * This function converts the provided EPSG:2056 coordinates into pixel
+     * coordinates for all the slices of the 3D raster in a single call, using
+     * the lc_frame_transform() function. The pixel coordinates are written as
+     * (u, v) pairs, one pair per slice, in the provided array, whatever their
+     * position with respect to the maps.
+     *
+     * A single coordinate is converted per call, the slices being processed
+     * one after the other, as the databases are read line by line.
+     *
+     * \param lc_list     3D raster descriptor
+     * \param lc_x        Easting coordinate
+     * \param lc_y        Northing coordinate
+     * \param lc_position Array receiving the pixel coordinates pairs
+     *
+     * \return Returns the number of slices on which the pixel lies on the map.
+     */
+
+    size_t lc_list_transform( lc_list_t const & lc_list, double const lc_x, double const lc_y, int32_t * const lc_position );
+
+    /*! \brief Conversion methods
+     *
+     * This function computes the union of the geographical boundaries of all
+     * the slices of the 3D raster, extended by one pixel of each slice on each
+     * side. Coordinates outside of this bounding box can not lie on any map
+     * according to lc_frame_transform(), the extension covering the rounding
+     * of the pixel coordinates.
+     *
+     * \param lc_list 3D raster descriptor
+     *
+     * \return Returns the bounding box of the 3D raster slices.
+     */
+
+    lc_bound_t lc_list_bound( lc_list_t const & lc_list );
+
+    /*! \brief Conversion methods
+     *
+     * This function checks if the provided EPSG:2056 coordinates are inside
+     * of the provided bounding box. Non-finite coordinates are considered as
+     * outside.
+     *
+     * \param lc_bound Bounding box
+     * \param lc_x     Easting coordinate
+     * \param lc_y     Northing coordinate
+     *
+     * \return Returns true if the coordinates are inside, false otherwise.
+     */
+
+    bool lc_bound_inside( lc_bound_t const & lc_bound, double const lc_x, double const lc_y );
+
 /*
     header - inclusion guard
  */
@@ -0,0 +1,126 @@
+/*
+ *  regbl - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+    # include "common-mark.hpp"
+
+/*
+    source - Mark methods
+ */
+
+    bool lc_mark_export( std::string const lc_path, std::vector< lc_mark_t > const & lc_mark ) {
+
+        /* output stream */
+        std::ofstream lc_stream( lc_path, std::ofstream::out );
+
+        /* check stream */
+        if ( lc_stream.is_open() == false ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* parsing marks */
+        for ( lc_mark_t const & lc_entry : lc_mark ) {
+
+            /* export mark */
+            lc_stream << lc_entry.mk_x << " " << lc_entry.mk_y << ( ( lc_entry.mk_found == true ) ? " 1\n" : " 0\n" );
+
+        }
+
+        /* delete stream */
+        lc_stream.close();
+
+        /* send message */
+        return( lc_stream.fail() == false );
+
+    }
+
+    bool lc_mark_import( std::string const lc_path, std::vector< lc_mark_t > & lc_mark ) {
+
+        /* importation buffer */
+        lc_mark_t lc_entry;
+
+        /* importation flag */
+        int lc_flag( 0 );
+
+        /* input stream */
+        std::ifstream lc_stream( lc_path, std::ifstream::in );
+
+        /* reset marks */
+        lc_mark.clear();
+
+        /* check stream */
+        if ( lc_stream.is_open() == false ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* parsing marks file */
+        while ( lc_stream >> lc_entry.mk_x >> lc_entry.mk_y >> lc_flag ) {
+
+            /* assign detection flag */
+            lc_entry.mk_found = ( lc_flag != 0 );
+
+            /* push mark */
+            lc_mark.push_back( lc_entry );
+
+        }
+
+        /* send message */
+        return( lc_stream.eof() == true );
+
+    }
+
+    void lc_mark_draw( cv::Mat & lc_overlay, std::vector< lc_mark_t > const & lc_mark, int const lc_x, int const lc_y ) {
+
+        /* cross color */
+        cv::Scalar lc_color;
+
+        /* cross center */
+        int lc_u( 0 );
+        int lc_v( 0 );
+
+        /* parsing marks */
+        for ( lc_mark_t const & lc_entry : lc_mark ) {
+
+            /* compute cross center in window */
+            lc_u = lc_entry.mk_x - lc_x;
+            lc_v = lc_entry.mk_y - lc_y;
+
+            /* check cross and window intersection */
+            if ( ( lc_u < - LC_MARK_HALF ) || ( lc_u >= lc_overlay.cols + LC_MARK_HALF ) ) continue;
+            if ( ( lc_v < - LC_MARK_HALF ) || ( lc_v >= lc_overlay.rows + LC_MARK_HALF ) ) continue;
+
+            /* update color */
+            lc_color = ( lc_entry.mk_found == true ) ? cv::Scalar( 0, 255, 0, 255 ) : cv::Scalar( 0, 0, 255, 255 );
+
+            /* draw cross */
+            cv::line( lc_overlay, cv::Point( lc_u               , lc_v - LC_MARK_HALF ), cv::Point( lc_u               , lc_v + LC_MARK_HALF ), lc_color );
+            cv::line( lc_overlay, cv::Point( lc_u - LC_MARK_HALF, lc_v                ), cv::Point( lc_u + LC_MARK_HALF, lc_v                ), lc_color );
+
+        }
+
+    }
+
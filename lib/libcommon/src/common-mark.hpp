@@ -0,0 +1,150 @@
+/*
+ *  regbl - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+    /*! \file   common-mark.hpp
+     *  \author Nils Hamel <nils.hamel@alumni.epfl.ch>
+     *  \author Huriel Reichel
+     *
+     *  regbl - common library - mark
+     */
+
+/*
+    header - inclusion guard
+ */
+
+    # ifndef __LC_MARK__
+    # define __LC_MARK__
+
+/*
+    header - internal includes
+ */
+
+/*
+    header - external includes
+ */
+
+    # include <iostream>
+    # include <fstream>
+    # include <string>
+    # include <vector>
+    # include <cstdint>
+    # include <opencv2/core/core.hpp>
+    # include <opencv2/highgui/highgui.hpp>
+    # include <opencv2/imgproc/imgproc.hpp>
+
+/*
+    header - preprocessor definitions
+ */
+
+    /* define mark cross half size - pixels */
+    # define LC_MARK_HALF ( 3 )
+
+/*
+    header - preprocessor macros
+ */
+
+/*
+    header - type definition
+ */
+
+/*
+    header - structures
+ */
+
+    /*! \struct lc_mark_struct
+     *  \brief Detection mark structure
+     *
+     *  This structure holds a detection mark of the detection overlays, that is
+     *  a position tried for a building on a map and its detection result.
+     *
+     *  \var lc_mark_struct::mk_x
+     *  Mark position, in column
+     *  \var lc_mark_struct::mk_y
+     *  Mark position, in row
+     *  \var lc_mark_struct::mk_found
+     *  Detection flag
+     */
+
+    typedef struct lc_mark_struct {
+
+        int32_t mk_x;
+        int32_t mk_y;
+        bool    mk_found;
+
+    } lc_mark_t;
+
+/*
+    header - function prototypes
+ */
+
+    /*! \brief Mark methods
+     *
+     * This function exports the provided marks in a text file, each line
+     * containing the column and row of the mark followed by its detection
+     * flag (detected 1, 0 otherwise). The order of the marks is kept, as it
+     * gives the drawing order of the overlapping crosses.
+     *
+     * \param lc_path Path of the marks file
+     * \param lc_mark Marks array
+     *
+     * \return Returns true on success, false otherwise.
+     */
+
+    bool lc_mark_export( std::string const lc_path, std::vector< lc_mark_t > const & lc_mark );
+
+    /*! \brief Mark methods
+     *
+     * This function imports the marks exported by lc_mark_export(). The content
+     * of the provided array is replaced.
+     *
+     * \param lc_path Path of the marks file
+     * \param lc_mark Marks array
+     *
+     * \return Returns true on success, false otherwise.
+     */
+
+    bool lc_mark_import( std::string const lc_path, std::vector< lc_mark_t > & lc_mark );
+
+    /*! \brief Mark methods
+     *
+     * This function draws the provided marks on an RGBA overlay covering a
+     * window of the map, given by the position of its top-left pixel. Each mark
+     * is drawn as a cross, green for a detected building and red otherwise,
+     * in the order of the array. The crosses are clipped by the overlay.
+     *
+     * Drawing all the marks of a year on an overlay of the map size, with a
+     * null origin, gives the full resolution detection overlay.
+     *
+     * \param lc_overlay Overlay image, expected to be an RGBA image
+     * \param lc_mark    Marks array
+     * \param lc_x       Window origin, in column
+     * \param lc_y       Window origin, in row
+     */
+
+    void lc_mark_draw( cv::Mat & lc_overlay, std::vector< lc_mark_t > const & lc_mark, int const lc_x, int const lc_y );
+
+/*
+    header - inclusion guard
+ */
+
+    # endif
+
@@ -0,0 +1,128 @@
+/*
+ *  regbl - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+    # include "common-shard.hpp"
+
+/*
+    source - Shard methods
+ */
+
+    bool lc_shard_read( int const argc, char ** argv, char const * const lc_long, char const * const lc_short, lc_shard_t & lc_shard ) {
+
+        /* shard specification */
+        char * lc_spec( lc_read_string( argc, argv, lc_long, lc_short ) );
+
+        /* parsing pointer */
+        char * lc_end( NULL );
+
+        /* default shard - all buildings */
+        lc_shard = { 0, 1 };
+
+        /* check specification */
+        if ( lc_spec == NULL ) return( true );
+
+        /* read shard index */
+        lc_shard.sh_index = std::strtoull( lc_spec, & lc_end, 10 );
+
+        /* check separator */
+        if ( ( lc_end == lc_spec ) || ( * lc_end != '/' ) ) return( false );
+
+        /* read shard count */
+        lc_shard.sh_count = std::strtoull( lc_spec = lc_end + 1, & lc_end, 10 );
+
+        /* check specification end */
+        if ( ( lc_end == lc_spec ) || ( * lc_end != '\0' ) ) return( false );
+
+        /* check shard consistency */
+        return( ( lc_shard.sh_count > 0 ) && ( lc_shard.sh_index < lc_shard.sh_count ) );
+
+    }
+
+    bool lc_shard_member( lc_shard_t const & lc_shard, int64_t const lc_egid ) {
+
+        /* check single shard */
+        if ( lc_shard.sh_count == 1 ) return( true );
+
+        /* compute building shard */
+        return( ( lc_hash_mix( lc_egid ) % lc_shard.sh_count ) == lc_shard.sh_index );
+
+    }
+
+    std::string lc_shard_path( std::string const & lc_path, lc_shard_t const & lc_shard ) {
+
+        /* check single shard */
+        if ( lc_shard.sh_count == 1 ) return( lc_path );
+
+        /* compose shard path */
+        return( lc_path + "_" + std::to_string( lc_shard.sh_index ) + "_" + std::to_string( lc_shard.sh_count ) );
+
+    }
+
+    bool lc_shard_merge( std::string const & lc_path, uint64_t const lc_count ) {
+
+        /* shard path */
+        std::string lc_shard;
+
+        /* filesystem error */
+        std::error_code lc_error;
+
+        /* check output directory */
+        if ( std::filesystem::exists( lc_path ) == true ) return( false );
+
+        /* parsing shards */
+        for ( uint64_t lc_index = 0; lc_index < lc_count; lc_index ++ ) {
+
+            /* check shard directory */
+            if ( std::filesystem::is_directory( lc_shard_path( lc_path, { lc_index, lc_count } ) ) == false ) return( false );
+
+        }
+
+        /* create output directory */
+        if ( std::filesystem::create_directories( lc_path, lc_error ) == false ) return( false );
+
+        /* parsing shards */
+        for ( uint64_t lc_index = 0; lc_index < lc_count; lc_index ++ ) {
+
+            /* compose shard path */
+            lc_shard = lc_shard_path( lc_path, { lc_index, lc_count } );
+
+            /* parsing shard files */
+            for ( std::filesystem::directory_entry const & lc_entry : std::filesystem::directory_iterator( lc_shard ) ) {
+
+                /* move file in output directory */
+                std::filesystem::rename( lc_entry.path(), std::filesystem::path( lc_path ) / lc_entry.path().filename(), lc_error );
+
+                /* check move */
+                if ( lc_error ) return( false );
+
+            }
+
+            /* remove emptied shard directory */
+            if ( std::filesystem::remove( lc_shard, lc_error ) == false ) return( false );
+
+        }
+
+        /* send message */
+        return( true );
+
+    }
+
@@ -0,0 +1,163 @@
+/*
+ *  regbl - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+    /*! \file   common-shard.hpp
+     *  \author Nils Hamel <nils.hamel@alumni.epfl.ch>
+     *  \author Huriel Reichel
+     *
+     *  regbl - common library - shard
+     */
+
+/*
+    header - inclusion guard
+ */
+
+    # ifndef __LC_SHARD__
+    # define __LC_SHARD__
+
+/*
+    header - internal includes
+ */
+
+    # include "common-args.hpp"
+    # include "common-hash.hpp"
+
+/*
+    header - external includes
+ */
+
+    # include <iostream>
+    # include <string>
+    # include <cstdlib>
+    # include <cstdint>
+    # include <filesystem>
+
+/*
+    header - preprocessor definitions
+ */
+
+/*
+    header - preprocessor macros
+ */
+
+/*
+    header - type definition
+ */
+
+/*
+    header - structures
+ */
+
+    /*! \struct lc_shard_struct
+     *  \brief Shard structure
+     *
+     *  This structure describes the part of the buildings processed by a run
+     *  of a per-building process. The buildings are split in a given amount of
+     *  shards according to a stable hash of their EGID, so that each building
+     *  belongs to the same shard whatever the process, the machine or the run.
+     *  A single shard means that all the buildings are processed.
+     *
+     *  \var lc_shard_struct::sh_index
+     *  Index of the shard, from zero to the amount of shards excluded
+     *  \var lc_shard_struct::sh_count
+     *  Amount of shards
+     */
+
+    typedef struct lc_shard_struct {
+
+        uint64_t sh_index;
+        uint64_t sh_count;
+
+    } lc_shard_t;
+
+/*
+    header - function prototypes
+ */
+
+    /*! \brief Shard methods
+     *
+     * This function reads a shard specification, given as "i/n", from the
+     * command line arguments. The index has to be lower than the amount of
+     * shards, which has to be at least one. If the argument is not provided,
+     * the shard is set to 0/1, selecting all the buildings.
+     *
+     * \param argc     Standard parameter
+     * \param argv     Standard parameter
+     * \param lc_long  Argument long name
+     * \param lc_short Argument short name
+     * \param lc_shard Shard structure
+     *
+     * \return Returns true on success, false on malformed specification.
+     */
+
+    bool lc_shard_read( int const argc, char ** argv, char const * const lc_long, char const * const lc_short, lc_shard_t & lc_shard );
+
+    /*! \brief Shard methods
+     *
+     * This function checks if the building of the provided EGID belongs to the
+     * provided shard, using the lc_hash_mix() function of its EGID.
+     *
+     * \param lc_shard Shard structure
+     * \param lc_egid  Building EGID
+     *
+     * \return Returns true if the building belongs to the shard.
+     */
+
+    bool lc_shard_member( lc_shard_t const & lc_shard, int64_t const lc_egid );
+
+    /*! \brief Shard methods
+     *
+     * This function composes the path of the output directory of a shard,
+     * obtained by suffixing the provided directory path with the shard index
+     * and count (output_detect_1_4 for example). The path is left unchanged
+     * for a single shard.
+     *
+     * \param lc_path  Output directory path
+     * \param lc_shard Shard structure
+     *
+     * \return Returns the shard output directory path.
+     */
+
+    std::string lc_shard_path( std::string const & lc_path, lc_shard_t const & lc_shard );
+
+    /*! \brief Shard methods
+     *
+     * This function merges the output directories of the provided amount of
+     * shards into the output directory. The output directory must not exist
+     * and all the shard directories have to be present. The files of each
+     * shard, named after the building EGID, are moved into the created output
+     * directory and the emptied shard directories are removed.
+     *
+     * \param lc_path  Output directory path
+     * \param lc_count Amount of shards
+     *
+     * \return Returns true on success, false otherwise.
+     */
+
+    bool lc_shard_merge( std::string const & lc_path, uint64_t const lc_count );
+
+/*
+    header - inclusion guard
+ */
+
+    # endif
+
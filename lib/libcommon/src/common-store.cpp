@@ -0,0 +1,384 @@
+/*
+ *  regbl - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+    # include "common-store.hpp"
+
+/*
+    source - Store methods
+ */
+
+    bool lc_store_open( std::string const lc_path, lc_store_t & lc_store ) {
+
+        /* file descriptor */
+        int lc_file( -1 );
+
+        /* file status */
+        struct stat lc_stat;
+
+        /* header pointer */
+        lc_store_header_t const * lc_header( NULL );
+
+        /* reading pointer */
+        char const * lc_read( NULL );
+
+        /* expected size */
+        size_t lc_size( 0 );
+
+        /* reset structure */
+        lc_store = lc_store_t();
+
+        /* open file */
+        if ( ( lc_file = open( lc_path.c_str(), O_RDONLY ) ) < 0 ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* retrieve file size */
+        if ( ( fstat( lc_file, & lc_stat ) != 0 ) || ( size_t( lc_stat.st_size ) < sizeof( lc_store_header_t ) ) ) {
+
+            /* delete descriptor */
+            close( lc_file );
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* map file */
+        lc_store.st_base = mmap( NULL, lc_stat.st_size, PROT_READ, MAP_SHARED, lc_file, 0 );
+
+        /* delete descriptor - mapping kept */
+        close( lc_file );
+
+        /* check mapping */
+        if ( lc_store.st_base == MAP_FAILED ) {
+
+            /* reset structure */
+            lc_store = lc_store_t();
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* assign mapping size */
+        lc_store.st_size = lc_stat.st_size;
+
+        /* assign header */
+        lc_header = ( lc_store_header_t const * ) lc_store.st_base;
+
+        /* check signature and version */
+        if ( ( std::memcmp( lc_header->sh_magic, LC_STORE_MAGIC, 8 ) != 0 ) || ( lc_header->sh_version != LC_STORE_VERSION ) ) {
+
+            /* release mapping */
+            lc_store_close( lc_store );
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* assign dimensions */
+        lc_store.st_years  = lc_header->sh_years;
+        lc_store.st_count  = lc_header->sh_count;
+        lc_store.st_points = lc_header->sh_points;
+
+        /* compute expected size */
+        lc_size = sizeof( lc_store_header_t );
+        lc_size += ( lc_store.st_count + 1 ) * sizeof( uint64_t );
+        lc_size += lc_store.st_count * sizeof( int64_t );
+        lc_size += lc_store.st_count * sizeof( uint64_t );
+        lc_size += lc_store.st_years * sizeof( int32_t );
+        lc_size += lc_store.st_count * sizeof( int32_t ) * 2;
+        lc_size += lc_store.st_points * lc_store.st_years * sizeof( int32_t ) * 2;
+
+        /* check size consistency */
+        if ( lc_size != lc_store.st_size ) {
+
+            /* release mapping */
+            lc_store_close( lc_store );
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* assign arrays */
+        lc_read = ( char const * ) lc_store.st_base + sizeof( lc_store_header_t );
+
+        /* assign arrays */
+        lc_store.st_offset    = ( uint64_t const * ) lc_read; lc_read += ( lc_store.st_count + 1 ) * sizeof( uint64_t );
+        lc_store.st_egid      = ( int64_t  const * ) lc_read; lc_read += lc_store.st_count * sizeof( int64_t );
+        lc_store.st_order     = ( uint64_t const * ) lc_read; lc_read += lc_store.st_count * sizeof( uint64_t );
+        lc_store.st_year      = ( int32_t  const * ) lc_read; lc_read += lc_store.st_years * sizeof( int32_t );
+        lc_store.st_reference = ( int32_t  const * ) lc_read; lc_read += lc_store.st_count * sizeof( int32_t );
+        lc_store.st_surface   = ( int32_t  const * ) lc_read; lc_read += lc_store.st_count * sizeof( int32_t );
+        lc_store.st_position  = ( int32_t  const * ) lc_read;
+
+        /* check offsets consistency */
+        if ( lc_store.st_offset[lc_store.st_count] != lc_store.st_points ) {
+
+            /* release mapping */
+            lc_store_close( lc_store );
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* send message */
+        return( true );
+
+    }
+
+    void lc_store_close( lc_store_t & lc_store ) {
+
+        /* check mapping */
+        if ( lc_store.st_base != NULL ) {
+
+            /* release mapping */
+            munmap( lc_store.st_base, lc_store.st_size );
+
+        }
+
+        /* reset structure */
+        lc_store = lc_store_t();
+
+    }
+
+    bool lc_store_check( lc_store_t const & lc_store, lc_list_t & lc_list ) {
+
+        /* check years count */
+        if ( lc_store.st_years != lc_list.size() ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* parsing years */
+        for ( uint32_t lc_parse = 0; lc_parse < lc_store.st_years; lc_parse ++ ) {
+
+            /* check year */
+            if ( lc_store.st_year[lc_parse] != lc_list[lc_parse].fr_year ) {
+
+                /* send message */
+                return( false );
+
+            }
+
+        }
+
+        /* send message */
+        return( true );
+
+    }
+
+    int64_t lc_store_find( lc_store_t const & lc_store, int64_t const lc_egid ) {
+
+        /* search egid */
+        int64_t const * lc_found( std::lower_bound( lc_store.st_egid, lc_store.st_egid + lc_store.st_count, lc_egid ) );
+
+        /* check search result */
+        if ( ( lc_found == lc_store.st_egid + lc_store.st_count ) || ( ( * lc_found ) != lc_egid ) ) {
+
+            /* send message */
+            return( -1 );
+
+        }
+
+        /* return index */
+        return( lc_found - lc_store.st_egid );
+
+    }
+
+    uint64_t lc_store_get_count( lc_store_t const & lc_store, uint64_t const lc_index ) {
+
+        /* return points count */
+        return( lc_store.st_offset[lc_index + 1] - lc_store.st_offset[lc_index] );
+
+    }
+
+    int32_t const * lc_store_get_position( lc_store_t const & lc_store, uint32_t const lc_year, uint64_t const lc_index ) {
+
+        /* return points pointer */
+        return( lc_store.st_position + ( lc_year * lc_store.st_points + lc_store.st_offset[lc_index] ) * 2 );
+
+    }
+
+    uint64_t lc_store_hilbert( uint32_t lc_x, uint32_t lc_y ) {
+
+        /* hilbert index */
+        uint64_t lc_index( 0 );
+
+        /* quadrant flags */
+        uint32_t lc_rx( 0 );
+        uint32_t lc_ry( 0 );
+
+        /* parsing levels - from the largest quadrants */
+        for ( uint64_t lc_side = uint64_t( 1 ) << 31; lc_side > 0; lc_side >>= 1 ) {
+
+            /* compute quadrant */
+            lc_rx = ( lc_x & lc_side ) ? 1 : 0;
+            lc_ry = ( lc_y & lc_side ) ? 1 : 0;
+
+            /* update index */
+            lc_index += lc_side * lc_side * ( ( 3 * lc_rx ) ^ lc_ry );
+
+            /* check quadrant rotation */
+            if ( lc_ry == 0 ) {
+
+                /* check quadrant reflection */
+                if ( lc_rx == 1 ) {
+
+                    /* reflect quadrant */
+                    lc_x = ~ lc_x;
+                    lc_y = ~ lc_y;
+
+                }
+
+                /* rotate quadrant */
+                std::swap( lc_x, lc_y );
+
+            }
+
+        }
+
+        /* return index */
+        return( lc_index );
+
+    }
+
+    bool lc_store_write( std::string const lc_path, std::vector< int32_t > const & lc_year, std::vector< lc_store_building_t > & lc_building ) {
+
+        /* store header */
+        lc_store_header_t lc_header;
+
+        /* store arrays */
+        std::vector< uint64_t > lc_offset( lc_building.size() + 1, 0 );
+        std::vector< int64_t  > lc_egid( lc_building.size() );
+        std::vector< uint64_t > lc_order( lc_building.size() );
+        std::vector< uint64_t > lc_curve( lc_building.size() );
+        std::vector< int32_t  > lc_reference( lc_building.size() );
+        std::vector< int32_t  > lc_surface( lc_building.size() );
+        std::vector< int32_t  > lc_position;
+
+        /* years count */
+        size_t lc_years( lc_year.size() );
+
+        /* points count */
+        size_t lc_count( 0 );
+
+        /* output stream */
+        std::ofstream lc_stream;
+
+        /* sort buildings on egid */
+        std::sort( lc_building.begin(), lc_building.end(), [] ( lc_store_building_t const & lc_a, lc_store_building_t const & lc_b ) { return( lc_a.sb_egid < lc_b.sb_egid ); } );
+
+        /* parsing buildings */
+        for ( size_t lc_parse = 0; lc_parse < lc_building.size(); lc_parse ++ ) {
+
+            /* assign building information */
+            lc_egid[lc_parse] = lc_building[lc_parse].sb_egid;
+            lc_reference[lc_parse] = lc_building[lc_parse].sb_reference;
+            lc_surface[lc_parse] = lc_building[lc_parse].sb_surface;
+
+            /* compute building offset */
+            lc_offset[lc_parse + 1] = lc_offset[lc_parse] + lc_building[lc_parse].sb_position.size() / ( lc_years * 2 );
+
+            /* compute building hilbert index - position on first year */
+            lc_curve[lc_parse] = lc_store_hilbert( lc_building[lc_parse].sb_position[0], lc_building[lc_parse].sb_position[1] );
+
+            /* assign building index */
+            lc_order[lc_parse] = lc_parse;
+
+        }
+
+        /* sort buildings indexes along hilbert curve */
+        std::stable_sort( lc_order.begin(), lc_order.end(), [ & lc_curve ] ( uint64_t const lc_a, uint64_t const lc_b ) { return( lc_curve[lc_a] < lc_curve[lc_b] ); } );
+
+        /* assign points count */
+        lc_count = lc_offset.back();
+
+        /* allocate positions array */
+        lc_position.resize( lc_count * lc_years * 2 );
+
+        /* parsing buildings */
+        for ( size_t lc_parse = 0; lc_parse < lc_building.size(); lc_parse ++ ) {
+
+            /* parsing building points */
+            for ( size_t lc_point = 0; lc_point < lc_offset[lc_parse + 1] - lc_offset[lc_parse]; lc_point ++ ) {
+
+                /* parsing years */
+                for ( size_t lc_index = 0; lc_index < lc_years; lc_index ++ ) {
+
+                    /* dispatch point in year-major order */
+                    lc_position[( lc_index * lc_count + lc_offset[lc_parse] + lc_point ) * 2 + 0] = lc_building[lc_parse].sb_position[( lc_point * lc_years + lc_index ) * 2 + 0];
+                    lc_position[( lc_index * lc_count + lc_offset[lc_parse] + lc_point ) * 2 + 1] = lc_building[lc_parse].sb_position[( lc_point * lc_years + lc_index ) * 2 + 1];
+
+                }
+
+            }
+
+        }
+
+        /* compose header */
+        std::memset( & lc_header, 0, sizeof( lc_store_header_t ) );
+        std::memcpy( lc_header.sh_magic, LC_STORE_MAGIC, 8 );
+
+        /* compose header */
+        lc_header.sh_version = LC_STORE_VERSION;
+        lc_header.sh_years = lc_years;
+        lc_header.sh_count = lc_building.size();
+        lc_header.sh_points = lc_count;
+
+        /* create output stream */
+        lc_stream.open( lc_path, std::ofstream::out | std::ofstream::binary );
+
+        /* check output stream */
+        if ( lc_stream.is_open() == false ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* export header and arrays */
+        lc_stream.write( ( char const * ) & lc_header, sizeof( lc_store_header_t ) );
+        lc_stream.write( ( char const * ) lc_offset.data(), lc_offset.size() * sizeof( uint64_t ) );
+        lc_stream.write( ( char const * ) lc_egid.data(), lc_egid.size() * sizeof( int64_t ) );
+        lc_stream.write( ( char const * ) lc_order.data(), lc_order.size() * sizeof( uint64_t ) );
+        lc_stream.write( ( char const * ) lc_year.data(), lc_year.size() * sizeof( int32_t ) );
+        lc_stream.write( ( char const * ) lc_reference.data(), lc_reference.size() * sizeof( int32_t ) );
+        lc_stream.write( ( char const * ) lc_surface.data(), lc_surface.size() * sizeof( int32_t ) );
+        lc_stream.write( ( char const * ) lc_position.data(), lc_position.size() * sizeof( int32_t ) );
+
+        /* delete output stream */
+        lc_stream.close();
+
+        /* send message */
+        return( lc_stream.good() );
+
+    }
+
@@ -0,0 +1,324 @@
+/*
+ *  regbl - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+    /*! \file   common-store.hpp
+     *  \author Nils Hamel <nils.hamel@alumni.epfl.ch>
+     *  \author Huriel Reichel
+     *
+     *  regbl - common library - store
+     */
+
+/*
+    header - inclusion guard
+ */
+
+    # ifndef __LC_STORE__
+    # define __LC_STORE__
+
+/*
+    header - internal includes
+ */
+
+    # include "common-list.hpp"
+
+/*
+    header - external includes
+ */
+
+    # include <iostream>
+    # include <fstream>
+    # include <string>
+    # include <vector>
+    # include <cstdint>
+    # include <cstring>
+    # include <algorithm>
+    # include <sys/mman.h>
+    # include <sys/stat.h>
+    # include <fcntl.h>
+    # include <unistd.h>
+
+/*
+    header - preprocessor definitions
+ */
+
+    /* define store signature */
+    # define LC_STORE_MAGIC   "REGBLSTO"
+
+    /* define store format version - 3 : buildings spatial order */
+    # define LC_STORE_VERSION ( 3 )
+
+    /* define missing value */
+    # define LC_STORE_NONE    ( -1 )
+
+/*
+    header - preprocessor macros
+ */
+
+/*
+    header - type definition
+ */
+
+/*
+    header - structures
+ */
+
+    /*! \struct lc_store_header_struct
+     *  \brief Store file header
+     *
+     *  This structure gives the layout of the header found at the beginning of
+     *  a store file. It is followed, in order, by the offsets array (uint64_t,
+     *  count + 1 values), the EGID array (int64_t, count values), the order
+     *  array (uint64_t, count values), the years array (int32_t, years
+     *  values), the reference dates array (int32_t, count values), the
+     *  surfaces array (int32_t, count values) and the positions array.
+     *
+     *  The positions array stores, for each year and in the same order as the
+     *  years array, the points of all buildings as (x, y) int32_t pairs. The
+     *  points of the building of index i are found between the offsets i and
+     *  i + 1. The first point of a building is its position, the following
+     *  ones being the position of its entries. The points are given in pixels,
+     *  the rows being counted from the top of the map since version 2.
+     *
+     *  The order array, added in version 3, gives the buildings indexes sorted
+     *  along the Hilbert curve of their position on the first year, so that
+     *  buildings processed in this order are close to each other on the maps.
+     *
+     *  \var lc_store_header_struct::sh_magic
+     *  Store file signature
+     *  \var lc_store_header_struct::sh_version
+     *  Store format version
+     *  \var lc_store_header_struct::sh_years
+     *  Number of years (3D raster slices)
+     *  \var lc_store_header_struct::sh_count
+     *  Number of buildings
+     *  \var lc_store_header_struct::sh_points
+     *  Number of points, for each year
+     */
+
+    typedef struct lc_store_header_struct {
+
+        char     sh_magic[8];
+        uint32_t sh_version;
+        uint32_t sh_years;
+        uint64_t sh_count;
+        uint64_t sh_points;
+
+    } lc_store_header_t;
+
+    /*! \struct lc_store_struct
+     *  \brief Store structure
+     *
+     *  This structure holds a memory-mapped store file along with pointers to
+     *  each of its arrays. It is filled by the lc_store_open() function and
+     *  released by the lc_store_close() one.
+     *
+     *  \var lc_store_struct::st_base
+     *  Mapping base address
+     *  \var lc_store_struct::st_size
+     *  Mapping size, in bytes
+     *  \var lc_store_struct::st_years
+     *  Number of years
+     *  \var lc_store_struct::st_count
+     *  Number of buildings
+     *  \var lc_store_struct::st_points
+     *  Number of points, for each year
+     *  \var lc_store_struct::st_offset
+     *  Buildings points offset
+     *  \var lc_store_struct::st_egid
+     *  Buildings EGID, sorted in ascending order
+     *  \var lc_store_struct::st_order
+     *  Buildings indexes, sorted along the Hilbert curve
+     *  \var lc_store_struct::st_year
+     *  Years of the 3D raster slices
+     *  \var lc_store_struct::st_reference
+     *  Buildings construction date, LC_STORE_NONE if missing
+     *  \var lc_store_struct::st_surface
+     *  Buildings surface, LC_STORE_NONE if missing
+     *  \var lc_store_struct::st_position
+     *  Buildings points, year by year
+     */
+
+    typedef struct lc_store_struct {
+
+        void *           st_base;
+        size_t           st_size;
+
+        uint32_t         st_years;
+        uint64_t         st_count;
+        uint64_t         st_points;
+
+        uint64_t const * st_offset;
+        int64_t  const * st_egid;
+        uint64_t const * st_order;
+        int32_t  const * st_year;
+        int32_t  const * st_reference;
+        int32_t  const * st_surface;
+        int32_t  const * st_position;
+
+    } lc_store_t;
+
+    /*! \struct lc_store_building_struct
+     *  \brief Store building structure
+     *
+     *  This structure is used to gather the information of a building before
+     *  the store file is written. The points are stored one after the other,
+     *  each point being given for all years in a row as (x, y) pairs.
+     *
+     *  \var lc_store_building_struct::sb_egid
+     *  Building EGID
+     *  \var lc_store_building_struct::sb_reference
+     *  Building construction date, LC_STORE_NONE if missing
+     *  \var lc_store_building_struct::sb_surface
+     *  Building surface, LC_STORE_NONE if missing
+     *  \var lc_store_building_struct::sb_position
+     *  Building points, for all years
+     */
+
+    typedef struct lc_store_building_struct {
+
+        int64_t                sb_egid;
+        int32_t                sb_reference;
+        int32_t                sb_surface;
+        std::vector< int32_t > sb_position;
+
+    } lc_store_building_t;
+
+/*
+    header - function prototypes
+ */
+
+    /*! \brief Store methods
+     *
+     * This function maps the provided store file in memory and sets the
+     * pointers of the store structure on its arrays. The file header is checked
+     * for its signature, its version and its size consistency.
+     *
+     * \param lc_path  Path of the store file
+     * \param lc_store Store structure
+     *
+     * \return Returns true on success, false otherwise.
+     */
+
+    bool lc_store_open( std::string const lc_path, lc_store_t & lc_store );
+
+    /*! \brief Store methods
+     *
+     * This function releases the memory mapping of the provided store and
+     * resets its structure.
+     *
+     * \param lc_store Store structure
+     */
+
+    void lc_store_close( lc_store_t & lc_store );
+
+    /*! \brief Store methods
+     *
+     * This function checks that the years of the store are the same, and in
+     * the same order, as the ones of the provided 3D raster descriptor.
+     *
+     * \param lc_store Store structure
+     * \param lc_list  3D raster descriptor
+     *
+     * \return Returns true if consistent, false otherwise.
+     */
+
+    bool lc_store_check( lc_store_t const & lc_store, lc_list_t & lc_list );
+
+    /*! \brief Store methods
+     *
+     * This function searches the provided EGID in the store using a binary
+     * search on the sorted EGID array.
+     *
+     * \param lc_store Store structure
+     * \param lc_egid  Building EGID
+     *
+     * \return Returns the index of the building, -1 if not found.
+     */
+
+    int64_t lc_store_find( lc_store_t const & lc_store, int64_t const lc_egid );
+
+    /*! \brief Store methods
+     *
+     * This function returns the number of points of the building designated by
+     * its index, that is one plus the number of its entries.
+     *
+     * \param lc_store Store structure
+     * \param lc_index Building index
+     *
+     * \return Returns the number of points.
+     */
+
+    uint64_t lc_store_get_count( lc_store_t const & lc_store, uint64_t const lc_index );
+
+    /*! \brief Store methods
+     *
+     * This function returns a pointer on the first point, for the designated
+     * year index, of the building designated by its index. The points are then
+     * given as (x, y) pairs.
+     *
+     * \param lc_store Store structure
+     * \param lc_year  Year index
+     * \param lc_index Building index
+     *
+     * \return Returns pointer on the building points.
+     */
+
+    int32_t const * lc_store_get_position( lc_store_t const & lc_store, uint32_t const lc_year, uint64_t const lc_index );
+
+    /*! \brief Store methods
+     *
+     * This function computes the index of the provided pixel along the Hilbert
+     * curve covering the 2^32 by 2^32 pixels square. Pixels close to each other
+     * along the curve are close to each other on the map.
+     *
+     * \param lc_x Pixel column
+     * \param lc_y Pixel row
+     *
+     * \return Returns the Hilbert index of the pixel.
+     */
+
+    uint64_t lc_store_hilbert( uint32_t lc_x, uint32_t lc_y );
+
+    /*! \brief Store methods
+     *
+     * This function writes a store file using the provided years and building
+     * structures. The buildings are first sorted according to their EGID. All
+     * buildings are expected to come with points for each provided year. The
+     * order array is computed using the lc_store_hilbert() function on the
+     * position of the buildings on the first year, equal indexes being kept
+     * in EGID order.
+     *
+     * \param lc_path     Path of the store file
+     * \param lc_year     Years of the 3D raster slices
+     * \param lc_building Building structures
+     *
+     * \return Returns true on success, false otherwise.
+     */
+
+    bool lc_store_write( std::string const lc_path, std::vector< int32_t > const & lc_year, std::vector< lc_store_building_t > & lc_building );
+
+/*
+    header - inclusion guard
+ */
+
+    # endif
+
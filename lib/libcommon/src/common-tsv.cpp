@@ -0,0 +1,688 @@
+/*
+ *  regbl - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+    # include "common-tsv.hpp"
+
+/*
+    source - TSV methods
+ */
+
+    bool lc_tsv_open( std::string const lc_path, lc_tsv_t & lc_tsv ) {
+
+        /* file descriptor */
+        int lc_file( -1 );
+
+        /* file status */
+        struct stat lc_stat;
+
+        /* file magic number */
+        unsigned char lc_magic[2] = { 0, 0 };
+
+        /* reset structure */
+        lc_tsv = lc_tsv_t();
+
+        /* check standard input */
+        if ( lc_path == LC_TSV_STDIN ) {
+
+            /* duplicate descriptor - closed with the stream */
+            if ( ( lc_file = dup( STDIN_FILENO ) ) < 0 ) {
+
+                /* send message */
+                return( false );
+
+            }
+
+            /* open stream */
+            return( lc_tsv_stream( lc_file, lc_tsv ) );
+
+        }
+
+        /* open file */
+        if ( ( lc_file = open( lc_path.c_str(), O_RDONLY ) ) < 0 ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* retrieve file size */
+        if ( fstat( lc_file, & lc_stat ) != 0 ) {
+
+            /* delete descriptor */
+            close( lc_file );
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* check gzip magic number */
+        if ( ( pread( lc_file, lc_magic, 2, 0 ) == 2 ) && ( lc_magic[0] == 0x1f ) && ( lc_magic[1] == 0x8b ) ) {
+
+            /* open stream */
+            return( lc_tsv_stream( lc_file, lc_tsv ) );
+
+        }
+
+        /* check file size */
+        if ( lc_stat.st_size > 0 ) {
+
+            /* map file */
+            lc_tsv.ts_base = mmap( NULL, lc_stat.st_size, PROT_READ, MAP_PRIVATE, lc_file, 0 );
+
+            /* check mapping */
+            if ( lc_tsv.ts_base == MAP_FAILED ) {
+
+                /* delete descriptor */
+                close( lc_file );
+
+                /* reset structure */
+                lc_tsv = lc_tsv_t();
+
+                /* send message */
+                return( false );
+
+            }
+
+            /* sequential access hint */
+            madvise( lc_tsv.ts_base, lc_stat.st_size, MADV_SEQUENTIAL );
+
+            /* assign mapping size */
+            lc_tsv.ts_size = lc_stat.st_size;
+
+        }
+
+        /* delete descriptor - mapping kept */
+        close( lc_file );
+
+        /* assign reading range */
+        lc_tsv.ts_head = ( char const * ) lc_tsv.ts_base;
+        lc_tsv.ts_tail = lc_tsv.ts_head + lc_tsv.ts_size;
+
+        /* send message */
+        return( true );
+
+    }
+
+    bool lc_tsv_stream( int const lc_file, lc_tsv_t & lc_tsv ) {
+
+        /* stream structure */
+        lc_tsv_stream_t * lc_stream( new lc_tsv_stream_t() );
+
+        /* open compressed stream - descriptor owned by the stream */
+        if ( ( lc_stream->ss_file = gzdopen( lc_file, "rb" ) ) == NULL ) {
+
+            /* delete descriptor */
+            close( lc_file );
+
+            /* delete stream structure */
+            delete lc_stream;
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* enlarge decompression buffer */
+        gzbuffer( lc_stream->ss_file, 1048576 );
+
+        /* initialise ring state */
+        lc_stream->ss_push = 0;
+        lc_stream->ss_pull = 0;
+        lc_stream->ss_hold = false;
+        lc_stream->ss_done = false;
+        lc_stream->ss_fail = false;
+        lc_stream->ss_stop = false;
+
+        /* start decompression thread */
+        lc_stream->ss_thread = std::thread( lc_tsv_produce, lc_stream );
+
+        /* assign stream - empty reading range */
+        lc_tsv.ts_stream = lc_stream;
+
+        /* send message */
+        return( true );
+
+    }
+
+    void lc_tsv_close( lc_tsv_t & lc_tsv ) {
+
+        /* check stream */
+        if ( lc_tsv.ts_stream != NULL ) {
+
+            /* request abort */
+            {
+
+                /* lock ring */
+                std::lock_guard< std::mutex > lc_lock( lc_tsv.ts_stream->ss_mutex );
+
+                /* update state */
+                lc_tsv.ts_stream->ss_stop = true;
+
+            }
+
+            /* wake decompression thread */
+            lc_tsv.ts_stream->ss_free.notify_all();
+
+            /* wait decompression thread */
+            lc_tsv.ts_stream->ss_thread.join();
+
+            /* close compressed stream */
+            gzclose( lc_tsv.ts_stream->ss_file );
+
+            /* delete stream structure */
+            delete lc_tsv.ts_stream;
+
+        }
+
+        /* check mapping */
+        if ( lc_tsv.ts_base != NULL ) {
+
+            /* release mapping */
+            munmap( lc_tsv.ts_base, lc_tsv.ts_size );
+
+        }
+
+        /* reset structure */
+        lc_tsv = lc_tsv_t();
+
+    }
+
+    void lc_tsv_produce( lc_tsv_stream_t * const lc_stream ) {
+
+        /* carried part of the last line */
+        std::vector< char > lc_carry;
+
+        /* ring slot */
+        size_t lc_slot( 0 );
+
+        /* block filling size */
+        size_t lc_size( 0 );
+
+        /* last line terminator */
+        size_t lc_last( 0 );
+
+        /* decompressed size */
+        int lc_read( 0 );
+
+        /* decompression error */
+        int lc_error( Z_OK );
+
+        /* stream state */
+        bool lc_end( false );
+        bool lc_fail( false );
+
+        /* filling blocks */
+        while ( lc_end == false ) {
+
+            /* wait free block */
+            {
+
+                /* lock ring */
+                std::unique_lock< std::mutex > lc_lock( lc_stream->ss_mutex );
+
+                /* wait free block or abort */
+                while ( ( lc_stream->ss_stop == false ) && ( lc_stream->ss_push - lc_stream->ss_pull >= LC_TSV_RING ) ) lc_stream->ss_free.wait( lc_lock );
+
+                /* check abort */
+                if ( lc_stream->ss_stop == true ) return;
+
+                /* assign slot */
+                lc_slot = lc_stream->ss_push % LC_TSV_RING;
+
+            }
+
+            /* block reference - slot owned by the thread */
+            std::vector< char > & lc_block( lc_stream->ss_block[lc_slot] );
+
+            /* allocate block */
+            lc_block.resize( std::max( size_t( LC_TSV_BLOCK ), lc_carry.size() * 2 ) );
+
+            /* copy carried part */
+            std::copy( lc_carry.begin(), lc_carry.end(), lc_block.begin() );
+
+            /* initialise block size */
+            lc_size = lc_carry.size();
+
+            /* filling block */
+            while ( true ) {
+
+                /* decompress until block is full */
+                while ( ( lc_end == false ) && ( lc_size < lc_block.size() ) ) {
+
+                    /* decompress stream */
+                    lc_read = gzread( lc_stream->ss_file, lc_block.data() + lc_size, std::min( lc_block.size() - lc_size, size_t( LC_TSV_BLOCK ) ) );
+
+                    /* check decompression */
+                    if ( lc_read < 0 ) {
+
+                        /* update state */
+                        lc_fail = true;
+
+                        /* update state */
+                        lc_end = true;
+
+                    } else if ( lc_read == 0 ) {
+
+                        /* check truncated stream */
+                        gzerror( lc_stream->ss_file, & lc_error );
+
+                        /* update state */
+                        lc_fail = ( lc_error != Z_OK );
+
+                        /* update state */
+                        lc_end = true;
+
+                    } else {
+
+                        /* update size */
+                        lc_size += lc_read;
+
+                    }
+
+                }
+
+                /* check end of stream - whole block kept */
+                if ( lc_end == true ) {
+
+                    /* reset carried part */
+                    lc_carry.clear();
+
+                    /* block done */
+                    break;
+
+                }
+
+                /* search last line terminator */
+                for ( lc_last = lc_size; ( lc_last > 0 ) && ( lc_block[lc_last - 1] != '\n' ); lc_last -- );
+
+                /* check line terminator */
+                if ( lc_last > 0 ) {
+
+                    /* carry the incomplete line */
+                    lc_carry.assign( lc_block.begin() + lc_last, lc_block.begin() + lc_size );
+
+                    /* cut block after terminator */
+                    lc_size = lc_last;
+
+                    /* block done */
+                    break;
+
+                }
+
+                /* enlarge block - line longer than block */
+                lc_block.resize( lc_block.size() * 2 );
+
+            }
+
+            /* publish block */
+            {
+
+                /* lock ring */
+                std::lock_guard< std::mutex > lc_lock( lc_stream->ss_mutex );
+
+                /* check block content */
+                if ( lc_size > 0 ) {
+
+                    /* assign block size */
+                    lc_stream->ss_size[lc_slot] = lc_size;
+
+                    /* update ring state */
+                    lc_stream->ss_push ++;
+
+                }
+
+                /* update stream state */
+                lc_stream->ss_done = lc_end;
+                lc_stream->ss_fail = lc_fail;
+
+            }
+
+            /* wake reader */
+            lc_stream->ss_fill.notify_all();
+
+        }
+
+    }
+
+    bool lc_tsv_block( lc_tsv_t & lc_tsv ) {
+
+        /* stream structure */
+        lc_tsv_stream_t * const lc_stream( lc_tsv.ts_stream );
+
+        /* ring slot */
+        size_t lc_slot( 0 );
+
+        /* check stream - mapped file is a single block */
+        if ( lc_stream == NULL ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* lock ring */
+        std::unique_lock< std::mutex > lc_lock( lc_stream->ss_mutex );
+
+        /* check held block */
+        if ( lc_stream->ss_hold == true ) {
+
+            /* release block */
+            lc_stream->ss_pull ++;
+
+            /* update state */
+            lc_stream->ss_hold = false;
+
+            /* wake decompression thread */
+            lc_stream->ss_free.notify_all();
+
+        }
+
+        /* wait filled block or end of stream */
+        while ( ( lc_stream->ss_push == lc_stream->ss_pull ) && ( lc_stream->ss_done == false ) ) lc_stream->ss_fill.wait( lc_lock );
+
+        /* check end of stream */
+        if ( lc_stream->ss_push == lc_stream->ss_pull ) {
+
+            /* assign error state */
+            lc_tsv.ts_fail = lc_stream->ss_fail;
+
+            /* reset reading range */
+            lc_tsv.ts_head = NULL;
+            lc_tsv.ts_tail = NULL;
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* assign slot */
+        lc_slot = lc_stream->ss_pull % LC_TSV_RING;
+
+        /* update state */
+        lc_stream->ss_hold = true;
+
+        /* assign reading range */
+        lc_tsv.ts_head = lc_stream->ss_block[lc_slot].data();
+        lc_tsv.ts_tail = lc_tsv.ts_head + lc_stream->ss_size[lc_slot];
+
+        /* send message */
+        return( true );
+
+    }
+
+    void lc_tsv_split( char const * lc_line, char const * const lc_end, std::vector< std::string_view > & lc_field ) {
+
+        /* delimiter pointer */
+        char const * lc_next( NULL );
+
+        /* line end - carriage return removed */
+        char const * lc_stop( ( ( lc_end > lc_line ) && ( * ( lc_end - 1 ) == '\r' ) ) ? lc_end - 1 : lc_end );
+
+        /* reset fields - capacity kept */
+        lc_field.clear();
+
+        /* parsing delimiters */
+        while ( ( lc_next = ( char const * ) std::memchr( lc_line, LC_TSV_DELIMITER, lc_stop - lc_line ) ) != NULL ) {
+
+            /* push field */
+            lc_field.emplace_back( lc_line, lc_next - lc_line );
+
+            /* update position */
+            lc_line = lc_next + 1;
+
+        }
+
+        /* push last field */
+        lc_field.emplace_back( lc_line, lc_stop - lc_line );
+
+    }
+
+    std::string_view lc_tsv_field( char const * lc_line, char const * const lc_end, int const lc_index ) {
+
+        /* delimiter pointer */
+        char const * lc_next( NULL );
+
+        /* line end - carriage return removed */
+        char const * lc_stop( ( ( lc_end > lc_line ) && ( * ( lc_end - 1 ) == '\r' ) ) ? lc_end - 1 : lc_end );
+
+        /* check index */
+        if ( lc_index < 0 ) {
+
+            /* return empty field */
+            return( std::string_view() );
+
+        }
+
+        /* parsing preceding fields */
+        for ( int lc_parse = 0; lc_parse < lc_index; lc_parse ++ ) {
+
+            /* search delimiter */
+            if ( ( lc_next = ( char const * ) std::memchr( lc_line, LC_TSV_DELIMITER, lc_stop - lc_line ) ) == NULL ) {
+
+                /* return empty field */
+                return( std::string_view() );
+
+            }
+
+            /* update position */
+            lc_line = lc_next + 1;
+
+        }
+
+        /* search field end */
+        if ( ( lc_next = ( char const * ) std::memchr( lc_line, LC_TSV_DELIMITER, lc_stop - lc_line ) ) == NULL ) {
+
+            /* last field */
+            lc_next = lc_stop;
+
+        }
+
+        /* return field */
+        return( std::string_view( lc_line, lc_next - lc_line ) );
+
+    }
+
+    bool lc_tsv_line( char const * & lc_head, char const * const lc_tail, char const * & lc_line, char const * & lc_end ) {
+
+        /* check end of range */
+        if ( lc_head >= lc_tail ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* search line end */
+        if ( ( lc_end = ( char const * ) std::memchr( lc_head, '\n', lc_tail - lc_head ) ) == NULL ) {
+
+            /* last line without terminator */
+            lc_end = lc_tail;
+
+        }
+
+        /* assign line beginning */
+        lc_line = lc_head;
+
+        /* update reading position */
+        lc_head = ( lc_end < lc_tail ) ? lc_end + 1 : lc_tail;
+
+        /* send message */
+        return( true );
+
+    }
+
+    bool lc_tsv_next( char const * & lc_head, char const * const lc_tail, std::vector< std::string_view > & lc_field ) {
+
+        /* line pointers */
+        char const * lc_line( NULL );
+        char const * lc_end ( NULL );
+
+        /* read next line */
+        if ( lc_tsv_line( lc_head, lc_tail, lc_line, lc_end ) == false ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* split line into fields */
+        lc_tsv_split( lc_line, lc_end, lc_field );
+
+        /* send message */
+        return( true );
+
+    }
+
+    bool lc_tsv_read( lc_tsv_t & lc_tsv ) {
+
+        /* read next line */
+        while ( lc_tsv_next( lc_tsv.ts_head, lc_tsv.ts_tail, lc_tsv.ts_field ) == false ) {
+
+            /* fetch next block */
+            if ( lc_tsv_block( lc_tsv ) == false ) {
+
+                /* send message */
+                return( false );
+
+            }
+
+        }
+
+        /* send message */
+        return( true );
+
+    }
+
+    void lc_tsv_chunk( lc_tsv_t const & lc_tsv, size_t const lc_count, std::vector< char const * > & lc_bound ) {
+
+        /* chunk size */
+        size_t lc_size( ( lc_tsv.ts_tail - lc_tsv.ts_head ) / lc_count );
+
+        /* boundary pointer */
+        char const * lc_next( NULL );
+
+        /* reset boundaries */
+        lc_bound.assign( 1, lc_tsv.ts_head );
+
+        /* parsing chunks */
+        for ( size_t lc_parse = 1; lc_parse < lc_count; lc_parse ++ ) {
+
+            /* compute nominal boundary - not before previous one */
+            lc_next = std::max( lc_tsv.ts_head + lc_parse * lc_size, lc_bound.back() );
+
+            /* align boundary on next line */
+            if ( ( lc_next > lc_tsv.ts_head ) && ( lc_next < lc_tsv.ts_tail ) && ( * ( lc_next - 1 ) != '\n' ) ) {
+
+                /* search line end */
+                if ( ( lc_next = ( char const * ) std::memchr( lc_next, '\n', lc_tsv.ts_tail - lc_next ) ) == NULL ) {
+
+                    /* no more line */
+                    lc_next = lc_tsv.ts_tail;
+
+                } else {
+
+                    /* move after line end */
+                    lc_next ++;
+
+                }
+
+            }
+
+            /* push boundary */
+            lc_bound.push_back( lc_next );
+
+        }
+
+        /* push last boundary */
+        lc_bound.push_back( lc_tsv.ts_tail );
+
+    }
+
+    int lc_tsv_header( lc_tsv_t const & lc_tsv, char const * const lc_target ) {
+
+        /* parsing fields */
+        for ( size_t lc_parse = 0; lc_parse < lc_tsv.ts_field.size(); lc_parse ++ ) {
+
+            /* target detection */
+            if ( lc_tsv.ts_field[lc_parse] == lc_target ) {
+
+                /* return index */
+                return( lc_parse );
+
+            }
+
+        }
+
+        /* send not found code */
+        return( -1 );
+
+    }
+
+    std::string_view lc_tsv_get( std::vector< std::string_view > const & lc_field, int const lc_index ) {
+
+        /* check index */
+        if ( ( lc_index < 0 ) || ( size_t( lc_index ) >= lc_field.size() ) ) {
+
+            /* return empty field */
+            return( std::string_view() );
+
+        }
+
+        /* return field */
+        return( lc_field[lc_index] );
+
+    }
+
+/*
+    source - Conversion methods
+ */
+
+    double lc_tsv_double( std::string_view lc_field ) {
+
+        /* converted value */
+        double lc_value( 0. );
+
+        /* skip leading spaces */
+        while ( ( lc_field.empty() == false ) && ( ( lc_field.front() == ' ' ) || ( lc_field.front() == '\t' ) ) ) lc_field.remove_prefix( 1 );
+
+        /* skip leading sign */
+        if ( ( lc_field.empty() == false ) && ( lc_field.front() == '+' ) ) lc_field.remove_prefix( 1 );
+
+        /* convert field */
+        std::from_chars( lc_field.data(), lc_field.data() + lc_field.size(), lc_value );
+
+        /* return value */
+        return( lc_value );
+
+    }
+
+    bool lc_tsv_integer( std::string_view const lc_field, int64_t & lc_value ) {
+
+        /* convert field */
+        std::from_chars_result lc_result( std::from_chars( lc_field.data(), lc_field.data() + lc_field.size(), lc_value ) );
+
+        /* check conversion */
+        return( ( lc_field.empty() == false ) && ( lc_result.ec == std::errc() ) && ( lc_result.ptr == lc_field.data() + lc_field.size() ) );
+
+    }
+
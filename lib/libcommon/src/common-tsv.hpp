@@ -0,0 +1,429 @@
+/*
+ *  regbl - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+    /*! \file   common-tsv.hpp
+     *  \author Nils Hamel <nils.hamel@alumni.epfl.ch>
+     *  \author Huriel Reichel
+     *
+     *  regbl - common library - tsv
+     */
+
+/*
+    header - inclusion guard
+ */
+
+    # ifndef __LC_TSV__
+    # define __LC_TSV__
+
+/*
+    header - internal includes
+ */
+
+/*
+    header - external includes
+ */
+
+    # include <iostream>
+    # include <string>
+    # include <string_view>
+    # include <vector>
+    # include <cstdint>
+    # include <cstring>
+    # include <charconv>
+    # include <algorithm>
+    # include <thread>
+    # include <mutex>
+    # include <condition_variable>
+    # include <zlib.h>
+    # include <sys/mman.h>
+    # include <sys/stat.h>
+    # include <fcntl.h>
+    # include <unistd.h>
+
+/*
+    header - preprocessor definitions
+ */
+
+    /* define fields delimiter */
+    # define LC_TSV_DELIMITER '\t'
+
+    /* define standard input path */
+    # define LC_TSV_STDIN "-"
+
+    /* define stream blocks size and count */
+    # define LC_TSV_BLOCK ( 16777216 )
+    # define LC_TSV_RING  ( 4 )
+
+/*
+    header - preprocessor macros
+ */
+
+/*
+    header - type definition
+ */
+
+/*
+    header - structures
+ */
+
+    /*! \struct lc_tsv_stream_struct
+     *  \brief TSV stream structure
+     *
+     *  This structure holds the state of a compressed or standard input TSV
+     *  stream. A decompression thread fills the blocks of a bounded ring, each
+     *  block being made of complete lines, while the reader consumes them in
+     *  order. A block is given back to the decompression thread only when the
+     *  reader moves to the next one.
+     *
+     *  \var lc_tsv_stream_struct::ss_file
+     *  Compressed stream handle
+     *  \var lc_tsv_stream_struct::ss_thread
+     *  Decompression thread
+     *  \var lc_tsv_stream_struct::ss_mutex
+     *  Ring access mutex
+     *  \var lc_tsv_stream_struct::ss_fill
+     *  Condition signaling a filled block or the end of the stream
+     *  \var lc_tsv_stream_struct::ss_free
+     *  Condition signaling a released block or an abort
+     *  \var lc_tsv_stream_struct::ss_block
+     *  Ring blocks
+     *  \var lc_tsv_stream_struct::ss_size
+     *  Ring blocks size, in bytes
+     *  \var lc_tsv_stream_struct::ss_push
+     *  Amount of blocks filled by the decompression thread
+     *  \var lc_tsv_stream_struct::ss_pull
+     *  Amount of blocks released by the reader
+     *  \var lc_tsv_stream_struct::ss_hold
+     *  Reader holding state of the block following the released ones
+     *  \var lc_tsv_stream_struct::ss_done
+     *  End of stream state
+     *  \var lc_tsv_stream_struct::ss_fail
+     *  Decompression error state
+     *  \var lc_tsv_stream_struct::ss_stop
+     *  Abort request state
+     */
+
+    typedef struct lc_tsv_stream_struct {
+
+        gzFile                          ss_file;
+        std::thread                     ss_thread;
+
+        std::mutex                      ss_mutex;
+        std::condition_variable         ss_fill;
+        std::condition_variable         ss_free;
+
+        std::vector< char >             ss_block[LC_TSV_RING];
+        size_t                          ss_size[LC_TSV_RING];
+
+        uint64_t                        ss_push;
+        uint64_t                        ss_pull;
+        bool                            ss_hold;
+
+        bool                            ss_done;
+        bool                            ss_fail;
+        bool                            ss_stop;
+
+    } lc_tsv_stream_t;
+
+    /*! \struct lc_tsv_struct
+     *  \brief TSV reader structure
+     *
+     *  This structure holds a memory-mapped tabulation-separated file along
+     *  with the reading position and the fields of the last read line. The
+     *  fields are views on the mapped file and remain valid until the reader
+     *  is closed.
+     *
+     *  For compressed files and standard input, the reading range is the
+     *  current block of the stream instead of the whole file, the fields then
+     *  remaining valid until the next line is read.
+     *
+     *  \var lc_tsv_struct::ts_base
+     *  Mapping base address
+     *  \var lc_tsv_struct::ts_size
+     *  Mapping size, in bytes
+     *  \var lc_tsv_struct::ts_head
+     *  Reading position
+     *  \var lc_tsv_struct::ts_tail
+     *  End of the mapped file
+     *  \var lc_tsv_struct::ts_field
+     *  Fields of the last read line
+     *  \var lc_tsv_struct::ts_stream
+     *  Stream state, NULL for memory-mapped files
+     *  \var lc_tsv_struct::ts_fail
+     *  Stream decompression error state
+     */
+
+    typedef struct lc_tsv_struct {
+
+        void *                          ts_base;
+        size_t                          ts_size;
+
+        char const *                    ts_head;
+        char const *                    ts_tail;
+
+        std::vector< std::string_view > ts_field;
+
+        lc_tsv_stream_t *               ts_stream;
+        bool                            ts_fail;
+
+    } lc_tsv_t;
+
+/*
+    header - function prototypes
+ */
+
+    /*! \brief TSV methods
+     *
+     * This function maps the provided file in memory and prepares the reader
+     * structure to read it from its first line.
+     *
+     * When the path is LC_TSV_STDIN or when the file starts with the gzip
+     * magic number, the file is read as a stream instead : the decompression
+     * thread is started and the reading range is given, block by block, by
+     * the lc_tsv_block() function. Standard input can be compressed or not.
+     *
+     * \param lc_path Path of the TSV file
+     * \param lc_tsv  Reader structure
+     *
+     * \return Returns true on success, false otherwise.
+     */
+
+    bool lc_tsv_open( std::string const lc_path, lc_tsv_t & lc_tsv );
+
+    /*! \brief TSV methods
+     *
+     * This function prepares the reader structure to read a compressed stream
+     * through the provided descriptor, which is then owned by the stream. The
+     * decompression thread is started, the reading range being initially empty.
+     * It is used by lc_tsv_open() for standard input and gzip files.
+     *
+     * \param lc_file Descriptor of the stream
+     * \param lc_tsv  Reader structure
+     *
+     * \return Returns true on success, false otherwise.
+     */
+
+    bool lc_tsv_stream( int const lc_file, lc_tsv_t & lc_tsv );
+
+    /*! \brief TSV methods
+     *
+     * This function releases the memory mapping of the provided reader and
+     * resets its structure. For a stream, the decompression thread is stopped
+     * and joined before the stream is closed.
+     *
+     * \param lc_tsv Reader structure
+     */
+
+    void lc_tsv_close( lc_tsv_t & lc_tsv );
+
+    /*! \brief TSV methods
+     *
+     * This function is the decompression thread of a stream. It fills the free
+     * blocks of the ring with the decompressed content of the stream, each
+     * block being cut after its last line terminator, the remaining part being
+     * carried at the beginning of the next block. A block holding a line longer
+     * than LC_TSV_BLOCK is enlarged. The thread ends at the end of the stream,
+     * on a decompression error, including a truncated stream, or when an
+     * abort is requested.
+     *
+     * \param lc_stream Stream structure
+     */
+
+    void lc_tsv_produce( lc_tsv_stream_t * const lc_stream );
+
+    /*! \brief TSV methods
+     *
+     * This function moves the reader to the next block of a stream, releasing
+     * the current one to the decompression thread. The reading range is set on
+     * the lines of the new block, which can then be read or split in chunks
+     * in the same way as a memory-mapped file.
+     *
+     * For a memory-mapped file, the whole file being a single block, the
+     * function does nothing.
+     *
+     * \param lc_tsv Reader structure
+     *
+     * \return Returns true if a new block is available, false at the end of
+     * the stream. The ts_fail field is set if the stream ended on error.
+     */
+
+    bool lc_tsv_block( lc_tsv_t & lc_tsv );
+
+    /*! \brief TSV methods
+     *
+     * This function splits the line given by its first and past-the-end
+     * characters into its fields, pushed as views in the provided array. The
+     * array is cleared before to be filled, keeping its capacity. A trailing
+     * carriage return is removed from the last field.
+     *
+     * The delimiters are searched using memchr(), which allows the whole line
+     * to be split in a single pass.
+     *
+     * \param lc_line  Line first character
+     * \param lc_end   Line past-the-end character
+     * \param lc_field Fields array
+     */
+
+    void lc_tsv_split( char const * lc_line, char const * const lc_end, std::vector< std::string_view > & lc_field );
+
+    /*! \brief TSV methods
+     *
+     * This function returns the field of the provided line designated by its
+     * index, without splitting the whole line. The line is given by the pointer
+     * on its first character and the pointer on its end, the line terminator
+     * being excluded. The returned field is the same as the one obtained
+     * through lc_tsv_split() and lc_tsv_get(), allowing to inspect a few fields
+     * before deciding to split the line.
+     *
+     * \param lc_line  Line first character
+     * \param lc_end   Line end
+     * \param lc_index Field index
+     *
+     * \return Returns the designated field, an empty one if it does not exist.
+     */
+
+    std::string_view lc_tsv_field( char const * lc_line, char const * const lc_end, int const lc_index );
+
+    /*! \brief TSV methods
+     *
+     * This function locates the line starting at the provided position, bounded
+     * by the provided end, without splitting it. The pointers on its first
+     * character and on its end, the terminator being excluded, are returned and
+     * the position is moved to the beginning of the next line.
+     *
+     * \param lc_head  Reading position, updated
+     * \param lc_tail  End of the range
+     * \param lc_line  Returned line first character
+     * \param lc_end   Returned line end
+     *
+     * \return Returns true if a line was located, false at the end of the range.
+     */
+
+    bool lc_tsv_line( char const * & lc_head, char const * const lc_tail, char const * & lc_line, char const * & lc_end );
+
+    /*! \brief TSV methods
+     *
+     * This function reads the line starting at the provided position, bounded
+     * by the provided end, using lc_tsv_line(), and splits it into its fields
+     * using the function lc_tsv_split(). The position is then moved to the
+     * beginning of the next line. This allows to read any range of lines of a
+     * mapped file.
+     *
+     * \param lc_head  Reading position, updated
+     * \param lc_tail  End of the range
+     * \param lc_field Fields array
+     *
+     * \return Returns true if a line was read, false at the end of the range.
+     */
+
+    bool lc_tsv_next( char const * & lc_head, char const * const lc_tail, std::vector< std::string_view > & lc_field );
+
+    /*! \brief TSV methods
+     *
+     * This function reads the next line of the file and splits it into its
+     * fields, available through the reader structure. There is no limitation
+     * on the length of the lines. For a stream, the next block is fetched
+     * using lc_tsv_block() when the current one is exhausted.
+     *
+     * \param lc_tsv Reader structure
+     *
+     * \return Returns true if a line was read, false at the end of the file.
+     */
+
+    bool lc_tsv_read( lc_tsv_t & lc_tsv );
+
+    /*! \brief TSV methods
+     *
+     * This function splits the remaining lines of the reading range, that is
+     * the file or the current block of a stream, starting at the current
+     * reading position, in the provided amount of chunks of similar size. The
+     * chunks boundaries are aligned on the beginning of the lines, so that
+     * each chunk can be read independently using lc_tsv_next(). The provided
+     * array receives the chunks boundaries, that is the amount of chunks plus
+     * one pointers. Some chunks can be empty.
+     *
+     * \param lc_tsv   Reader structure
+     * \param lc_count Amount of chunks
+     * \param lc_bound Chunks boundaries array
+     */
+
+    void lc_tsv_chunk( lc_tsv_t const & lc_tsv, size_t const lc_count, std::vector< char const * > & lc_bound );
+
+    /*! \brief TSV methods
+     *
+     * This function searches the field corresponding to the provided name in
+     * the last read line, expected to be the header line of the file.
+     *
+     * \param lc_tsv    Reader structure
+     * \param lc_target Name of the field
+     *
+     * \return Returns the index of the field, -1 if not found.
+     */
+
+    int lc_tsv_header( lc_tsv_t const & lc_tsv, char const * const lc_target );
+
+    /*! \brief TSV methods
+     *
+     * This function returns the field of the provided fields array designated
+     * by its index. An empty view is returned if the line has not enough
+     * fields.
+     *
+     * \param lc_field Fields array
+     * \param lc_index Index of the field
+     *
+     * \return Returns the field view.
+     */
+
+    std::string_view lc_tsv_get( std::vector< std::string_view > const & lc_field, int const lc_index );
+
+    /*! \brief Conversion methods
+     *
+     * This function converts the provided field into a floating point value.
+     * As for atof(), leading spaces are skipped, the longest valid prefix is
+     * converted and zero is returned if no conversion can be performed.
+     *
+     * \param lc_field Field view
+     *
+     * \return Returns the converted value.
+     */
+
+    double lc_tsv_double( std::string_view lc_field );
+
+    /*! \brief Conversion methods
+     *
+     * This function converts the provided field into an integer value. The
+     * conversion succeeds only if the whole field is a valid integer.
+     *
+     * \param lc_field Field view
+     * \param lc_value Converted value
+     *
+     * \return Returns true on success, false otherwise.
+     */
+
+    bool lc_tsv_integer( std::string_view const lc_field, int64_t & lc_value );
+
+/*
+    header - inclusion guard
+ */
+
+    # endif
+
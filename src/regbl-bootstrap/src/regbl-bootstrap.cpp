@@ -25,16 +25,195 @@
     source - Extraction methods
  */
 
-    void regbl_bootstrap_extract( std::string regbl_GEB_path, std::string regbl_export_egid, std::string regbl_export_position, std::string regbl_export_reference, std::string regbl_export_surface, lc_list_t & regbl_list ) {
+    void regbl_bootstrap_extract_chunk( char const * regbl_head, char const * const regbl_tail, int const regbl_EGID, int const regbl_GKODE, int const regbl_GKODN, int const regbl_GBAUJ, int const regbl_GAREA, std::vector< regbl_area_t > const & regbl_area, lc_grid_t const & regbl_grid, std::vector< std::vector< lc_store_building_t > > & regbl_chunk, std::string & regbl_warning, std::vector< regbl_count_t > & regbl_counter ) {
 
-        /* reading buffers */
-        char regbl_head[REGBL_BUFFER] = { 0 };
-        char regbl_line[REGBL_BUFFER] = { 0 };
+        /* line pointers */
+        char const * regbl_line( NULL );
+        char const * regbl_end ( NULL );
+
+        /* line fields */
+        std::vector< std::string_view > regbl_field;
 
         /* reading token */
-        char regbl_token[REGBL_BUFFER] = { 0 };
-        char regbl_rdate[REGBL_BUFFER] = { 0 };
-        char regbl_rarea[REGBL_BUFFER] = { 0 };
+        std::string_view regbl_token;
+        std::string_view regbl_rdate;
+        std::string_view regbl_rarea;
+
+        /* warning suffix - area path on multiple areas */
+        std::string regbl_suffix;
+
+        /* coordinates variable */
+        double regbl_x( 0. );
+        double regbl_y( 0. );
+
+        /* selection count */
+        size_t regbl_count( 0 );
+
+        /* rows count */
+        uint64_t regbl_read( 0 );
+
+        /* line state */
+        bool regbl_split( false );
+        bool regbl_valid( false );
+
+        /* grid cell areas */
+        uint32_t const * regbl_item( NULL );
+        uint32_t regbl_items( 0 );
+
+        /* building egid */
+        int64_t regbl_egid( 0 );
+
+        /* conversion value */
+        int64_t regbl_value( 0 );
+
+        /* transfer array - one pixel pair per slice of largest list */
+        std::vector < int32_t > regbl_transfer;
+
+        /* building structure */
+        lc_store_building_t regbl_record;
+
+        /* parsing areas */
+        for ( regbl_area_t const & regbl_entry : regbl_area ) {
+
+            /* update transfer array size */
+            if ( regbl_transfer.size() < regbl_entry.ar_list.size() * 2 ) regbl_transfer.resize( regbl_entry.ar_list.size() * 2 );
+
+        }
+
+        /* parsing chunk entries */
+        while ( lc_tsv_line( regbl_head, regbl_tail, regbl_line, regbl_end ) == true ) {
+
+            /* update counter */
+            regbl_read ++;
+
+            /* read and convert coordinates token - line not split */
+            regbl_x = lc_tsv_double( lc_tsv_field( regbl_line, regbl_end, regbl_GKODE ) );
+            regbl_y = lc_tsv_double( lc_tsv_field( regbl_line, regbl_end, regbl_GKODN ) );
+
+            /* search areas of grid cell - rows outside of all cells rejected */
+            regbl_items = lc_grid_find( regbl_grid, regbl_x, regbl_y, regbl_item );
+
+            /* reset line state */
+            regbl_split = false;
+            regbl_valid = false;
+
+            /* parsing cell areas */
+            for ( uint32_t regbl_parse = 0; regbl_parse < regbl_items; regbl_parse ++ ) {
+
+                /* area reference */
+                regbl_area_t const & regbl_entry( regbl_area[regbl_item[regbl_parse]] );
+
+                /* fast rejection - outside of all area slices */
+                if ( lc_bound_inside( regbl_entry.ar_box, regbl_x, regbl_y ) == false ) continue;
+
+                /* check line state */
+                if ( regbl_split == false ) {
+
+                    /* split line into fields */
+                    lc_tsv_split( regbl_line, regbl_end, regbl_field );
+
+                    /* read egid token */
+                    regbl_token = lc_tsv_get( regbl_field, regbl_EGID );
+
+                    /* read reference date */
+                    regbl_rdate = lc_tsv_get( regbl_field, regbl_GBAUJ );
+
+                    /* read reference area */
+                    regbl_rarea = lc_tsv_get( regbl_field, regbl_GAREA );
+
+                    /* convert and check egid token */
+                    regbl_valid = lc_tsv_integer( regbl_token, regbl_egid );
+
+                    /* update line state */
+                    regbl_split = true;
+
+                }
+
+                /* convert position for all area slices */
+                regbl_count = lc_list_transform( regbl_entry.ar_list, regbl_x, regbl_y, regbl_transfer.data() );
+
+                /* check transfer array */
+                if ( regbl_count != regbl_entry.ar_list.size() ) {
+
+                    /* detect partial selection */
+                    if ( regbl_count > 0 ) {
+
+                        /* update counter */
+                        regbl_counter[regbl_item[regbl_parse]].ct_partial ++;
+
+                        /* compose warning suffix */
+                        regbl_suffix = ( regbl_area.size() > 1 ) ? " (" + regbl_entry.ar_path + ")" : "";
+
+                        /* stack warning */
+                        regbl_warning += "warning : rejected building (" + std::string( regbl_token ) + ") as partially appearing on spatio-temporal raster" + regbl_suffix + "\n";
+
+                    } else {
+
+                        /* update counter */
+                        regbl_counter[regbl_item[regbl_parse]].ct_outside ++;
+
+                    }
+
+                } else {
+
+                    /* check egid token */
+                    if ( regbl_valid == false ) {
+
+                        /* update counter */
+                        regbl_counter[regbl_item[regbl_parse]].ct_egid ++;
+
+                        /* compose warning suffix */
+                        regbl_suffix = ( regbl_area.size() > 1 ) ? " (" + regbl_entry.ar_path + ")" : "";
+
+                        /* stack warning */
+                        regbl_warning += "warning : rejected building (" + std::string( regbl_token ) + ") as EGID is not numerical" + regbl_suffix + "\n";
+
+                        /* skip building */
+                        continue;
+
+                    }
+
+                    /* assign building information */
+                    regbl_record.sb_egid = regbl_egid;
+
+                    /* assign reference date */
+                    regbl_record.sb_reference = ( lc_tsv_integer( regbl_rdate, regbl_value ) == true ) ? regbl_value : LC_STORE_NONE;
+
+                    /* assign surface value */
+                    regbl_record.sb_surface = ( lc_tsv_integer( regbl_rarea, regbl_value ) == true ) ? regbl_value : LC_STORE_NONE;
+
+                    /* assign building points */
+                    regbl_record.sb_position.assign( regbl_transfer.begin(), regbl_transfer.begin() + regbl_entry.ar_list.size() * 2 );
+
+                    /* update counter */
+                    regbl_counter[regbl_item[regbl_parse]].ct_accept ++;
+
+                    /* push building in area chunk */
+                    regbl_chunk[regbl_item[regbl_parse]].push_back( regbl_record );
+
+                }
+
+            }
+
+        }
+
+        /* parsing areas counters */
+        for ( regbl_count_t & regbl_entry : regbl_counter ) {
+
+            /* assign rows read */
+            regbl_entry.ct_read = regbl_read;
+
+            /* deduce rows rejected by bounding box */
+            regbl_entry.ct_filter = regbl_read - regbl_entry.ct_outside - regbl_entry.ct_partial - regbl_entry.ct_egid - regbl_entry.ct_accept;
+
+        }
+
+    }
+
+    void regbl_bootstrap_extract( std::string regbl_GEB_path, std::vector< regbl_area_t > & regbl_area, lc_grid_t const & regbl_grid, int const regbl_threads ) {
+
+        /* database reader */
+        lc_tsv_t regbl_tsv;
 
         /* detection index */
         int regbl_EGID ( 0 );
@@ -43,25 +222,23 @@
         int regbl_GBAUJ( 0 );
         int regbl_GAREA( 0 );
 
-        /* coordinates variable */
-        double regbl_x( 0. );
-        double regbl_y( 0. );
+        /* index search */
+        uint64_t regbl_found( LC_HASH_NONE );
 
-        /* coordinates variable */
-        int regbl_u( 0. );
-        int regbl_v( 0. );
+        /* chunks boundaries */
+        std::vector< char const * > regbl_bound;
 
-        /* transfer matrix */
-        std::vector < std::vector< int > > regbl_transfer;
+        /* chunks buildings - one array per area */
+        std::vector< std::vector< std::vector< lc_store_building_t > > > regbl_chunk;
 
-        /* exportation stream */
-        std::ofstream regbl_output;
+        /* chunks warnings */
+        std::vector< std::string > regbl_warning;
 
-        /* create database stream */
-        std::ifstream regbl_stream( regbl_GEB_path, std::ifstream::in );
+        /* chunks counters - one per area */
+        std::vector< std::vector< regbl_count_t > > regbl_counter;
 
-        /* check stream */
-        if ( regbl_stream.is_open() == false ) {
+        /* create database reader */
+        if ( lc_tsv_open( regbl_GEB_path, regbl_tsv ) == false ) {
 
             /* display message */
             std::cerr << "error : unable to open GEB database" << std::endl;
@@ -72,10 +249,10 @@
         }
 
         /* import database header */
-        regbl_stream.getline( regbl_head, REGBL_BUFFER );
+        lc_tsv_read( regbl_tsv );
 
         /* detect and check entry */
-        if ( ( regbl_EGID  = regbl_detect_database_header( regbl_head, "EGID"  ) ) < 0 ) {
+        if ( ( regbl_EGID  = lc_tsv_header( regbl_tsv, "EGID" ) ) < 0 ) {
 
             /* display message */
             std::cerr << "error : unable to locate EGID in GEB database" << std::endl;
@@ -86,7 +263,7 @@
         }
 
         /* detect and check entry */
-        if ( ( regbl_GKODE = regbl_detect_database_header( regbl_head, "GKODE" ) ) < 0 ) {
+        if ( ( regbl_GKODE = lc_tsv_header( regbl_tsv, "GKODE" ) ) < 0 ) {
 
             /* display message */
             std::cerr << "error : unable to locate GKODE in GEB database" << std::endl;
@@ -97,7 +274,7 @@
         }
 
         /* detect and check entry */
-        if ( ( regbl_GKODN = regbl_detect_database_header( regbl_head, "GKODN" ) ) < 0 ) {
+        if ( ( regbl_GKODN = lc_tsv_header( regbl_tsv, "GKODN" ) ) < 0 ) {
 
             /* display message */
             std::cerr << "error : unable to locate GKODN in GEB database" << std::endl;
@@ -108,7 +285,7 @@
         }
 
         /* detect and check entry */
-        if ( ( regbl_GBAUJ = regbl_detect_database_header( regbl_head, "GBAUJ" ) ) < 0 ) {
+        if ( ( regbl_GBAUJ = lc_tsv_header( regbl_tsv, "GBAUJ" ) ) < 0 ) {
 
             /* display message */
             std::cerr << "error : unable to locate GBAUJ in GEB database" << std::endl;
@@ -119,7 +296,7 @@
         }
 
         /* detect and check entry */
-        if ( ( regbl_GAREA = regbl_detect_database_header( regbl_head, "GAREA" ) ) < 0 ) {
+        if ( ( regbl_GAREA = lc_tsv_header( regbl_tsv, "GAREA" ) ) < 0 ) {
 
             /* display message */
             std::cerr << "error : unable to locate GAREA in GEB database" << std::endl;
@@ -129,171 +306,99 @@
 
         }
 
-        /* parsing database entries */
-        while ( regbl_stream.getline( regbl_line, REGBL_BUFFER ) ) {
-
-            /* read coordinates token */
-            regbl_detect_database_entry( regbl_line, regbl_GKODE, regbl_token );
-
-            /* convert token */
-            regbl_x = std::atof( regbl_token );
-
-            /* read coordinates token */
-            regbl_detect_database_entry( regbl_line, regbl_GKODN, regbl_token );
-
-            /* convert token */
-            regbl_y = std::atof( regbl_token );
-
-            /* read egid token */
-            regbl_detect_database_entry( regbl_line, regbl_EGID, regbl_token );
-
-            /* read reference date */
-            regbl_detect_database_entry( regbl_line, regbl_GBAUJ, regbl_rdate );
+        /* parsing database blocks - whole file when mapped */
+        do {
 
-            /* read reference area */
-            regbl_detect_database_entry( regbl_line, regbl_GAREA, regbl_rarea );
+            /* split block entries in chunks - four per thread for balancing */
+            lc_tsv_chunk( regbl_tsv, ( regbl_threads > 1 ) ? regbl_threads * 4 : 1, regbl_bound );
 
-            /* reset transfer matrix */
-            regbl_transfer.clear();
+            /* allocate chunks results */
+            regbl_chunk.assign( regbl_bound.size() - 1, std::vector< std::vector< lc_store_building_t > >( regbl_area.size() ) );
+            regbl_warning.assign( regbl_bound.size() - 1, std::string() );
+            regbl_counter.assign( regbl_bound.size() - 1, std::vector< regbl_count_t >( regbl_area.size(), regbl_count_t() ) );
 
-            /* parsing storage list */
-            for ( unsigned int regbl_parse = 0; regbl_parse < regbl_list.size(); regbl_parse ++ ) {
-
-                /* convert coordinate according to current map */
-                regbl_u = std::round( ( ( regbl_x - std::stod( regbl_list[regbl_parse][1] ) ) / ( std::stod( regbl_list[regbl_parse][2] ) - std::stod( regbl_list[regbl_parse][1] ) ) ) * std::stod( regbl_list[regbl_parse][5] ) );
-                regbl_v = std::round( ( ( regbl_y - std::stod( regbl_list[regbl_parse][3] ) ) / ( std::stod( regbl_list[regbl_parse][4] ) - std::stod( regbl_list[regbl_parse][3] ) ) ) * std::stod( regbl_list[regbl_parse][6] ) );
-
-                /* check coordinates */
-                if ( ( regbl_u >= 0. ) && ( regbl_u < std::stoi( regbl_list[regbl_parse][5] ) ) && ( regbl_v >= 0. ) && ( regbl_v < std::stoi( regbl_list[regbl_parse][6] ) ) ) {
+            /* parsing chunks */
+            # pragma omp parallel for schedule(dynamic) num_threads(regbl_threads)
+            for ( size_t regbl_parse = 0; regbl_parse < regbl_chunk.size(); regbl_parse ++ ) {
 
-                    /* add matrix row */
-                    regbl_transfer.push_back( std::vector < int > (2) );
-
-                    /* push coordinates */
-                    regbl_transfer.back()[0] = regbl_u;
-                    regbl_transfer.back()[1] = regbl_v;
-
-                }
+                /* extract chunk buildings */
+                regbl_bootstrap_extract_chunk( regbl_bound[regbl_parse], regbl_bound[regbl_parse + 1], regbl_EGID, regbl_GKODE, regbl_GKODN, regbl_GBAUJ, regbl_GAREA, regbl_area, regbl_grid, regbl_chunk[regbl_parse], regbl_warning[regbl_parse], regbl_counter[regbl_parse] );
 
             }
 
-            /* check transfer matrix */
-            if ( regbl_transfer.size() != regbl_list.size() ) {
+            /* merging chunks - file order */
+            for ( size_t regbl_parse = 0; regbl_parse < regbl_chunk.size(); regbl_parse ++ ) {
 
-                /* detect partial selection */
-                if ( regbl_transfer.size() > 0 ) {
+                /* display chunk warnings */
+                std::cerr << regbl_warning[regbl_parse] << std::flush;
 
-                    /* display warning */
-                    std::cerr << "warning : rejected building (" << regbl_token << ") as partially appearing on spatio-temporal raster" << std::endl;
+                /* parsing areas */
+                for ( size_t regbl_index = 0; regbl_index < regbl_area.size(); regbl_index ++ ) {
 
-                }
+                    /* area reference */
+                    regbl_area_t & regbl_entry( regbl_area[regbl_index] );
 
-            } else {
+                    /* accumulate chunk counters */
+                    regbl_entry.ar_count.ct_read    += regbl_counter[regbl_parse][regbl_index].ct_read;
+                    regbl_entry.ar_count.ct_filter  += regbl_counter[regbl_parse][regbl_index].ct_filter;
+                    regbl_entry.ar_count.ct_outside += regbl_counter[regbl_parse][regbl_index].ct_outside;
+                    regbl_entry.ar_count.ct_partial += regbl_counter[regbl_parse][regbl_index].ct_partial;
+                    regbl_entry.ar_count.ct_egid    += regbl_counter[regbl_parse][regbl_index].ct_egid;
+                    regbl_entry.ar_count.ct_accept  += regbl_counter[regbl_parse][regbl_index].ct_accept;
 
-                /* create egid stream */
-                regbl_output.open( regbl_export_egid + "/" + regbl_token, std::ofstream::out );
+                    /* parsing chunk buildings */
+                    for ( lc_store_building_t & regbl_record : regbl_chunk[regbl_parse][regbl_index] ) {
 
-                /* chech egid stream */
-                if ( regbl_output.is_open() == false ) {
+                        /* check egid index */
+                        if ( ( regbl_found = lc_hash_find( regbl_entry.ar_index, regbl_record.sb_egid ) ) == LC_HASH_NONE ) {
 
-                    /* display message */
-                    std::cerr << "error : unable to write in storage structure : egid file" << std::endl;
+                            /* index building */
+                            lc_hash_insert( regbl_entry.ar_index, regbl_record.sb_egid, regbl_entry.ar_building.size() );
 
-                    /* send message */
-                    exit( 1 );
+                            /* push building */
+                            regbl_entry.ar_building.push_back( std::move( regbl_record ) );
 
-                }
+                        } else {
 
-                /* delete egid stream */
-                regbl_output.close();
-
-                /* parsing storage list */
-                for ( unsigned int regbl_parse = 0; regbl_parse < regbl_list.size(); regbl_parse ++ ) {
-
-                    /* create output stream */
-                    regbl_output.open( regbl_export_position + "/" + regbl_list[regbl_parse][0] + "/" + regbl_token, std::ofstream::out );
-
-                    /* check output stream */
-                    if ( regbl_output.is_open() == false ) {
-
-                        /* display message */
-                        std::cerr << "error : unable to write in storage structure : position file" << std::endl;
-
-                        /* send message */
-                        exit( 1 );
-
-                    }
-
-                    /* export position */
-                    regbl_output << regbl_transfer[regbl_parse][0] << " " << regbl_transfer[regbl_parse][1] << std::endl;
-
-                    /* delete output stream */
-                    regbl_output.close();
-
-                }
-
-                /* check reference date */
-                if ( std::strlen( regbl_rdate ) > 0 ) {
-                
-                    /* create reference stream */
-                    regbl_output.open( regbl_export_reference + "/" + regbl_token, std::ofstream::out );
+                            /* replace building - last occurrence kept */
+                            regbl_entry.ar_building[regbl_found] = std::move( regbl_record );
 
-                    /* check reference stream */
-                    if ( regbl_output.is_open() == false ) {
-
-                        /* display message */
-                        std::cerr << "error : unable to write in storage structure : reference file" << std::endl;
-
-                        /* send message */
-                        exit( 1 );
+                        }
 
                     }
 
-                    /* export reference date */
-                    regbl_output << regbl_rdate << std::endl;
-
-                    /* delete reference stream */
-                    regbl_output.close();
-
                 }
 
-                /* create surface stream */
-                regbl_output.open( regbl_export_surface + "/" + regbl_token, std::ofstream::out );
-
-                /* check surface stream */
-                if ( regbl_output.is_open() == false ) {
+                /* release chunk memory */
+                std::vector< std::vector< lc_store_building_t > >().swap( regbl_chunk[regbl_parse] );
 
-                    /* display message */
-                    std::cerr << "error : unable to write in storage structure : surface file" << std::endl;
-
-                    /* send message */
-                    exit( 1 );                    
+            }
 
-                }
+        } while ( lc_tsv_block( regbl_tsv ) == true );
 
-                /* export surface value */
-                regbl_output << regbl_rarea << std::endl;
+        /* check database stream */
+        if ( regbl_tsv.ts_fail == true ) {
 
-                /* delete surface stream */
-                regbl_output.close();
+            /* display message */
+            std::cerr << "error : unable to decompress GEB database" << std::endl;
 
-            }
+            /* abort */
+            exit( 1 );
 
         }
 
-        /* delete database stream */
-        regbl_stream.close(); 
+        /* delete database reader */
+        lc_tsv_close( regbl_tsv );
 
     }
 
-    void regbl_bootstrap_entries( std::string regbl_EIN_path, std::string regbl_export_egid, std::string regbl_export_position, lc_list_t & regbl_list ) {
+    void regbl_bootstrap_entries( std::string regbl_EIN_path, std::vector< regbl_area_t > & regbl_area, lc_grid_t const & regbl_grid ) {
 
-        /* reading buffers */
-        char regbl_head[REGBL_BUFFER] = { 0 };
-        char regbl_line[REGBL_BUFFER] = { 0 };
+        /* database reader */
+        lc_tsv_t regbl_tsv;
 
         /* reading token */
-        char regbl_token[REGBL_BUFFER] = { 0 };
+        std::string_view regbl_token;
 
         /* detection index */
         int regbl_EGID ( 0 );
@@ -304,21 +409,32 @@
         double regbl_x( 0. );
         double regbl_y( 0. );
 
-        /* coordinates variable */
-        int regbl_u( 0. );
-        int regbl_v( 0. );
+        /* selection count */
+        size_t regbl_count( 0 );
 
-        /* transfer matrix */
-        std::vector < std::vector< int > > regbl_transfer;
+        /* building egid */
+        int64_t regbl_egid( 0 );
 
-        /* exportation stream */
-        std::ofstream regbl_output;
+        /* index search */
+        uint64_t regbl_found( LC_HASH_NONE );
 
-        /* create database stream */
-        std::ifstream regbl_stream( regbl_EIN_path, std::ifstream::in );
+        /* grid cell areas */
+        uint32_t const * regbl_item( NULL );
+        uint32_t regbl_items( 0 );
 
-        /* check stream */
-        if ( regbl_stream.is_open() == false ) {
+        /* transfer array - one pixel pair per slice of largest list */
+        std::vector < int32_t > regbl_transfer;
+
+        /* parsing areas */
+        for ( regbl_area_t const & regbl_entry : regbl_area ) {
+
+            /* update transfer array size */
+            if ( regbl_transfer.size() < regbl_entry.ar_list.size() * 2 ) regbl_transfer.resize( regbl_entry.ar_list.size() * 2 );
+
+        }
+
+        /* create database reader */
+        if ( lc_tsv_open( regbl_EIN_path, regbl_tsv ) == false ) {
 
             /* display message */
             std::cerr << "error : unable to open EIN database" << std::endl;
@@ -329,10 +445,10 @@
         }
 
         /* import database header */
-        regbl_stream.getline( regbl_head, REGBL_BUFFER );
+        lc_tsv_read( regbl_tsv );
 
         /* detect and check entry */
-        if ( ( regbl_EGID  = regbl_detect_database_header( regbl_head, "EGID"  ) ) < 0 ) {
+        if ( ( regbl_EGID  = lc_tsv_header( regbl_tsv, "EGID" ) ) < 0 ) {
 
             /* display message */
             std::cerr << "error : unable to locate EGID in EIN database" << std::endl;
@@ -343,7 +459,7 @@
         }
 
         /* detect and check entry */
-        if ( ( regbl_DKODE = regbl_detect_database_header( regbl_head, "DKODE" ) ) < 0 ) {
+        if ( ( regbl_DKODE = lc_tsv_header( regbl_tsv, "DKODE" ) ) < 0 ) {
 
             /* display message */
             std::cerr << "error : unable to locate DKODE in EIN database" << std::endl;
@@ -354,7 +470,7 @@
         }
 
         /* detect and check entry */
-        if ( ( regbl_DKODN = regbl_detect_database_header( regbl_head, "DKODN" ) ) < 0 ) {
+        if ( ( regbl_DKODN = lc_tsv_header( regbl_tsv, "DKODN" ) ) < 0 ) {
 
             /* display message */
             std::cerr << "error : unable to locate DKODN in EIN database" << std::endl;
@@ -365,90 +481,227 @@
         }
 
         /* parsing database entries */
-        while ( regbl_stream.getline( regbl_line, REGBL_BUFFER ) ) {
+        while ( lc_tsv_read( regbl_tsv ) == true ) {
 
             /* read coordinates token */
-            regbl_detect_database_entry( regbl_line, regbl_DKODE, regbl_token );
+            regbl_token = lc_tsv_get( regbl_tsv.ts_field, regbl_DKODE );
 
             /* check token state */
-            if ( std::strlen( regbl_token ) > 0 ) {
+            if ( regbl_token.empty() == false ) {
 
                 /* convert token */
-                regbl_x = std::atof( regbl_token );
+                regbl_x = lc_tsv_double( regbl_token );
 
                 /* read coordinates token */
-                regbl_detect_database_entry( regbl_line, regbl_DKODN, regbl_token );
+                regbl_token = lc_tsv_get( regbl_tsv.ts_field, regbl_DKODN );
 
                 /* check token state */
-                if ( std::strlen( regbl_token ) > 0 ) {
+                if ( regbl_token.empty() == false ) {
 
                     /* convert token */
-                    regbl_y = std::atof( regbl_token );
+                    regbl_y = lc_tsv_double( regbl_token );
 
                     /* read egid token */
-                    regbl_detect_database_entry( regbl_line, regbl_EGID, regbl_token );
+                    regbl_token = lc_tsv_get( regbl_tsv.ts_field, regbl_EGID );
+
+                    /* convert and check egid token */
+                    if ( lc_tsv_integer( regbl_token, regbl_egid ) == false ) continue;
 
-                    /* check egid selection */
-                    if ( std::filesystem::is_regular_file( regbl_export_egid + "/" + regbl_token ) == true ) {
+                    /* search areas of grid cell */
+                    regbl_items = lc_grid_find( regbl_grid, regbl_x, regbl_y, regbl_item );
 
-                        /* reset transfer matrix */
-                        regbl_transfer.clear();
+                    /* parsing cell areas */
+                    for ( uint32_t regbl_parse = 0; regbl_parse < regbl_items; regbl_parse ++ ) {
 
-                        /* parsing storage list */
-                        for ( unsigned int regbl_parse = 0; regbl_parse < regbl_list.size(); regbl_parse ++ ) {
+                        /* area reference */
+                        regbl_area_t & regbl_entry( regbl_area[regbl_item[regbl_parse]] );
 
-                            /* convert coordinate according to current map */
-                            regbl_u = std::round( ( ( regbl_x - std::stod( regbl_list[regbl_parse][1] ) ) / ( std::stod( regbl_list[regbl_parse][2] ) - std::stod( regbl_list[regbl_parse][1] ) ) ) * std::stod( regbl_list[regbl_parse][5] ) );
-                            regbl_v = std::round( ( ( regbl_y - std::stod( regbl_list[regbl_parse][3] ) ) / ( std::stod( regbl_list[regbl_parse][4] ) - std::stod( regbl_list[regbl_parse][3] ) ) ) * std::stod( regbl_list[regbl_parse][6] ) );
+                        /* fast rejection - outside of all area slices */
+                        if ( lc_bound_inside( regbl_entry.ar_box, regbl_x, regbl_y ) == false ) continue;
 
-                            /* check coordinates */
-                            if ( ( regbl_u >= 0. ) && ( regbl_u < std::stoi( regbl_list[regbl_parse][5] ) ) && ( regbl_v >= 0. ) && ( regbl_v < std::stoi( regbl_list[regbl_parse][6] ) ) ) {
+                        /* check egid selection */
+                        if ( ( regbl_found = lc_hash_find( regbl_entry.ar_index, regbl_egid ) ) == LC_HASH_NONE ) continue;
 
-                                /* add matrix rows */
-                                regbl_transfer.push_back( std::vector < int > (2) );
+                        /* convert position for all area slices */
+                        regbl_count = lc_list_transform( regbl_entry.ar_list, regbl_x, regbl_y, regbl_transfer.data() );
 
-                                /* push coordinates */
-                                regbl_transfer.back()[0] = regbl_u;
-                                regbl_transfer.back()[1] = regbl_v;
+                        /* check selection */
+                        if ( regbl_count == regbl_entry.ar_list.size() ) {
 
-                            }
+                            /* append entry position */
+                            regbl_entry.ar_building[regbl_found].sb_position.insert( regbl_entry.ar_building[regbl_found].sb_position.end(), regbl_transfer.begin(), regbl_transfer.begin() + regbl_count * 2 );
 
                         }
 
-                        /* check selection */
-                        if ( regbl_transfer.size() == regbl_list.size() ) {
+                    }
 
-                            /* parsing storage list */
-                            for ( unsigned int regbl_parse = 0; regbl_parse < regbl_list.size(); regbl_parse ++ ) {
+                }
 
-                                /* create output stream */
-                                regbl_output.open( regbl_export_position + "/" + regbl_list[regbl_parse][0] + "/" + regbl_token, std::ofstream::app );
+            }
 
-                                /* check output stream */
-                                if ( regbl_output.is_open() == false ) {
+        }
 
-                                    /* display message */
-                                    std::cerr << "error : unable to write in storage structure : position file" << std::endl;
+        /* check database stream */
+        if ( regbl_tsv.ts_fail == true ) {
 
-                                    /* send message */
-                                    exit( 1 );
+            /* display message */
+            std::cerr << "error : unable to decompress EIN database" << std::endl;
 
-                                }
+            /* abort */
+            exit( 1 );
 
-                                /* export position */
-                                regbl_output << regbl_transfer[regbl_parse][0] << " " << regbl_transfer[regbl_parse][1] << std::endl;
+        }
 
-                                /* delete output stream */
-                                regbl_output.close();
+        /* delete database reader */
+        lc_tsv_close( regbl_tsv );
 
-                            }
+    }
 
-                        }
+/*
+    source - Exportation methods
+ */
 
-                    }
+    void regbl_bootstrap_legacy( std::vector< lc_store_building_t > & regbl_building, std::string regbl_export_egid, std::string regbl_export_position, std::string regbl_export_reference, std::string regbl_export_surface, lc_list_t & regbl_list ) {
+
+        /* egid string */
+        std::string regbl_egid;
+
+        /* exportation stream */
+        std::ofstream regbl_output;
+
+        /* parsing buildings */
+        for ( lc_store_building_t const & regbl_record : regbl_building ) {
+
+            /* compose egid string */
+            regbl_egid = std::to_string( regbl_record.sb_egid );
+
+            /* create egid stream */
+            regbl_output.open( regbl_export_egid + "/" + regbl_egid, std::ofstream::out );
+
+            /* chech egid stream */
+            if ( regbl_output.is_open() == false ) {
+
+                /* display message */
+                std::cerr << "error : unable to write in storage structure : egid file" << std::endl;
+
+                /* send message */
+                exit( 1 );
+
+            }
+
+            /* delete egid stream */
+            regbl_output.close();
+
+            /* parsing storage list */
+            for ( unsigned int regbl_parse = 0; regbl_parse < regbl_list.size(); regbl_parse ++ ) {
+
+                /* create output stream */
+                regbl_output.open( regbl_export_position + "/" + regbl_list[regbl_parse].fr_name + "/" + regbl_egid, std::ofstream::out );
+
+                /* check output stream */
+                if ( regbl_output.is_open() == false ) {
+
+                    /* display message */
+                    std::cerr << "error : unable to write in storage structure : position file" << std::endl;
+
+                    /* send message */
+                    exit( 1 );
+
+                }
+
+                /* parsing building points */
+                for ( size_t regbl_point = regbl_parse * 2; regbl_point < regbl_record.sb_position.size(); regbl_point += regbl_list.size() * 2 ) {
+
+                    /* export position */
+                    regbl_output << regbl_record.sb_position[regbl_point] << " " << regbl_record.sb_position[regbl_point + 1] << std::endl;
+
+                }
+
+                /* delete output stream */
+                regbl_output.close();
+
+            }
+
+            /* check reference date */
+            if ( regbl_record.sb_reference != LC_STORE_NONE ) {
+
+                /* create reference stream */
+                regbl_output.open( regbl_export_reference + "/" + regbl_egid, std::ofstream::out );
+
+                /* check reference stream */
+                if ( regbl_output.is_open() == false ) {
+
+                    /* display message */
+                    std::cerr << "error : unable to write in storage structure : reference file" << std::endl;
+
+                    /* send message */
+                    exit( 1 );
 
                 }
 
+                /* export reference date */
+                regbl_output << regbl_record.sb_reference << std::endl;
+
+                /* delete reference stream */
+                regbl_output.close();
+
+            }
+
+            /* create surface stream */
+            regbl_output.open( regbl_export_surface + "/" + regbl_egid, std::ofstream::out );
+
+            /* check surface stream */
+            if ( regbl_output.is_open() == false ) {
+
+                /* display message */
+                std::cerr << "error : unable to write in storage structure : surface file" << std::endl;
+
+                /* send message */
+                exit( 1 );
+
+            }
+
+            /* export surface value */
+            if ( regbl_record.sb_surface != LC_STORE_NONE ) regbl_output << regbl_record.sb_surface;
+
+            /* export surface value */
+            regbl_output << std::endl;
+
+            /* delete surface stream */
+            regbl_output.close();
+
+        }
+
+    }
+
+    void regbl_bootstrap_legacy_remove( std::vector< lc_change_t > const & regbl_change, std::string regbl_export_egid, std::string regbl_export_position, std::string regbl_export_reference, std::string regbl_export_surface, lc_list_t & regbl_list ) {
+
+        /* egid string */
+        std::string regbl_egid;
+
+        /* removal error */
+        std::error_code regbl_error;
+
+        /* parsing changes */
+        for ( lc_change_t const & regbl_entry : regbl_change ) {
+
+            /* check change type - added buildings have no files */
+            if ( regbl_entry.ch_type == LC_CHANGE_ADD ) continue;
+
+            /* compose egid string */
+            regbl_egid = std::to_string( regbl_entry.ch_egid );
+
+            /* remove building files - missing ones ignored */
+            std::filesystem::remove( regbl_export_egid + "/" + regbl_egid, regbl_error );
+            std::filesystem::remove( regbl_export_reference + "/" + regbl_egid, regbl_error );
+            std::filesystem::remove( regbl_export_surface + "/" + regbl_egid, regbl_error );
+
+            /* parsing storage list */
+            for ( unsigned int regbl_parse = 0; regbl_parse < regbl_list.size(); regbl_parse ++ ) {
+
+                /* remove building position file */
+                std::filesystem::remove( regbl_export_position + "/" + regbl_list[regbl_parse].fr_name + "/" + regbl_egid, regbl_error );
+
             }
 
         }
@@ -456,122 +709,368 @@
     }
 
 /*
-    source - Database methods
+    source - Area methods
  */
 
-    int regbl_detect_database_header( char const * const regbl_line, char const * const regbl_target ) {
+    bool regbl_bootstrap_areas( std::string regbl_areas_path, std::vector< regbl_area_t > & regbl_area ) {
 
-        /* parsing flag */
-        bool regbl_parse( true );
+        /* input stream */
+        std::ifstream regbl_stream( regbl_areas_path, std::ifstream::in );
 
-        /* segmentation index */
-        int regbl_tail( 0 );
-        int regbl_head( 0 );
+        /* reading line */
+        std::string regbl_line;
 
-        /* token variable */
-        char regbl_token[REGBL_BUFFER] = { 0 };
+        /* check stream */
+        if ( regbl_stream.is_open() == false ) {
 
-        /* detection index */
-        int regbl_index( 0 );
+            /* send message */
+            return( false );
 
-        /* parsing characters */
-        while ( regbl_parse == true ) {
+        }
 
-            /* delimiter detection */
-            if ( ( regbl_line[regbl_head] == REGBL_DELIMITER ) || ( regbl_line[regbl_head] == '\0' ) ) {
+        /* parsing stream lines */
+        while ( std::getline( regbl_stream, regbl_line ) ) {
 
-                /* extract token */
-                memcpy( regbl_token, regbl_line + regbl_tail, regbl_head - regbl_tail );
+            /* remove carriage return */
+            if ( ( regbl_line.empty() == false ) && ( regbl_line.back() == '\r' ) ) regbl_line.pop_back();
 
-                /* adding termination char */
-                regbl_token[regbl_head - regbl_tail] = '\0';
+            /* ignore empty lines */
+            if ( regbl_line.empty() == true ) continue;
 
-                /* target detection */
-                if ( strcmp( regbl_token, regbl_target ) == 0 ) {
+            /* parsing areas - duplicated storage paths */
+            for ( regbl_area_t const & regbl_entry : regbl_area ) {
 
-                    /* return index */
-                    return( regbl_index );
+                /* compare normalised paths */
+                if ( std::filesystem::path( regbl_entry.ar_path ).lexically_normal() == std::filesystem::path( regbl_line ).lexically_normal() ) {
 
-                } else {
+                    /* send message */
+                    return( false );
 
-                    /* update index */
-                    regbl_index ++;
+                }
 
-                    /* push new tail */
-                    regbl_tail = regbl_head + 1;
+            }
 
-                    /* detect end of string */
-                    if ( regbl_line[regbl_head] == '\0' ) {
+            /* push area */
+            regbl_area.emplace_back();
 
-                        /* update parser flag */
-                        regbl_parse = false;
+            /* assign area storage path */
+            regbl_area.back().ar_path = regbl_line;
 
-                    }
+        }
 
-                }
+        /* send message */
+        return( regbl_area.empty() == false );
+
+    }
+
+    void regbl_bootstrap_prepare( regbl_area_t & regbl_area, bool const regbl_legacy, bool const regbl_update, bool const regbl_multi ) {
+
+        /* message suffix - area path on multiple areas */
+        std::string regbl_suffix( ( regbl_multi == true ) ? " (" + regbl_area.ar_path + ")" : "" );
+
+        /* path composition */
+        std::string regbl_export_store( regbl_area.ar_path + "/regbl_output/output_store" );
+        std::string regbl_export_egid( regbl_area.ar_path + "/regbl_output/output_egid" );
+        std::string regbl_export_position( regbl_area.ar_path + "/regbl_output/output_position" );
+        std::string regbl_export_reference( regbl_area.ar_path + "/regbl_output/output_reference" );
+        std::string regbl_export_surface( regbl_area.ar_path + "/regbl_output/output_surface" );
+
+        /* import storage list */
+        regbl_area.ar_list = lc_list_import( regbl_area.ar_path + "/regbl_list" );
+
+        /* check storage list */
+        if ( regbl_area.ar_list.size() == 0 ) {
+
+            /* display message */
+            std::cerr << "error : unable to import storage list file" << regbl_suffix << std::endl;
+
+            /* abort */
+            exit( 1 );
+
+        }
+
+        /* check update mode */
+        if ( regbl_update == false ) {
+
+            /* check store */
+            if ( std::filesystem::exists( regbl_export_store ) == true ) {
+
+                /* display message */
+                std::cerr << "error : store already processed" << regbl_suffix << std::endl;
+
+                /* abort */
+                exit( 1 );
+
+            }
+
+        } else {
+
+            /* import previous building store */
+            if ( lc_store_open( regbl_export_store, regbl_area.ar_previous ) == false ) {
+
+                /* display message */
+                std::cerr << "error : unable to import building store for update" << regbl_suffix << std::endl;
+
+                /* abort */
+                exit( 1 );
 
             }
 
-            /* update head */
-            regbl_head ++;
+            /* check store and list consistency */
+            if ( lc_store_check( regbl_area.ar_previous, regbl_area.ar_list ) == false ) {
+
+                /* display message */
+                std::cerr << "error : inconsistency between building store and storage list" << regbl_suffix << std::endl;
+
+                /* abort */
+                exit( 1 );
+
+            }
 
         }
 
-        /* send not found code */
-        return( -1 );
+        /* check legacy exportation */
+        if ( ( regbl_legacy == true ) && ( regbl_update == false ) ) {
+
+            /* check directories */
+            if ( ( std::filesystem::is_directory( regbl_export_egid ) == true ) || ( std::filesystem::is_directory( regbl_export_position ) == true ) || ( std::filesystem::is_directory( regbl_export_reference ) == true ) || ( std::filesystem::is_directory( regbl_export_surface ) == true ) ) {
+
+                /* display message */
+                std::cerr << "error : legacy directories already processed" << regbl_suffix << std::endl;
+
+                /* abort */
+                exit( 1 );
+
+            }
+
+        }
+
+        /* check legacy update */
+        if ( ( regbl_legacy == true ) && ( regbl_update == true ) ) {
+
+            /* check directories */
+            if ( ( std::filesystem::is_directory( regbl_export_egid ) == false ) || ( std::filesystem::is_directory( regbl_export_position ) == false ) || ( std::filesystem::is_directory( regbl_export_reference ) == false ) || ( std::filesystem::is_directory( regbl_export_surface ) == false ) ) {
+
+                /* display message */
+                std::cerr << "error : unable to locate legacy directories for update" << regbl_suffix << std::endl;
+
+                /* abort */
+                exit( 1 );
+
+            }
+
+        }
+
+        /* create directory */
+        std::filesystem::create_directories( regbl_area.ar_path + "/regbl_output" );
+
+        /* compute slices bounding box */
+        regbl_area.ar_box = lc_list_bound( regbl_area.ar_list );
+
+        /* create buildings index */
+        lc_hash_create( regbl_area.ar_index, LC_HASH_BASE );
 
     }
 
-    void regbl_detect_database_entry( char const * const regbl_line, int const regbl_target, char * const regbl_token ) {
+    void regbl_bootstrap_export( regbl_area_t & regbl_area, bool const regbl_legacy, bool const regbl_update, bool const regbl_multi ) {
 
-        /* parsing flag */
-        bool regbl_parse( true );
+        /* message suffix - area path on multiple areas */
+        std::string regbl_suffix( ( regbl_multi == true ) ? " (" + regbl_area.ar_path + ")" : "" );
 
-        /* segmentation index */
-        int regbl_tail( 0 );
-        int regbl_head( 0 );
+        /* path composition */
+        std::string regbl_export_store( regbl_area.ar_path + "/regbl_output/output_store" );
+        std::string regbl_export_change( regbl_area.ar_path + "/regbl_output/output_change" );
+        std::string regbl_export_egid( regbl_area.ar_path + "/regbl_output/output_egid" );
+        std::string regbl_export_position( regbl_area.ar_path + "/regbl_output/output_position" );
+        std::string regbl_export_reference( regbl_area.ar_path + "/regbl_output/output_reference" );
+        std::string regbl_export_surface( regbl_area.ar_path + "/regbl_output/output_surface" );
 
-        /* detection index */
-        int regbl_index( 0 );
+        /* path composition - store written aside and swapped on update */
+        std::string regbl_export_write( regbl_export_store + ( ( regbl_update == true ) ? ".update" : "" ) );
+
+        /* path composition - changes written aside and swapped on update */
+        std::string regbl_export_aside( regbl_export_change + ".update" );
+
+        /* building store - update */
+        lc_store_t regbl_current;
+
+        /* pending and merged changes - update */
+        std::vector< lc_change_t > regbl_pending;
+        std::vector< lc_change_t > regbl_merge;
 
-        /* parsing characters */
-        while ( regbl_parse == true ) {
+        /* changes counters */
+        size_t regbl_added( 0 );
+        size_t regbl_removed( 0 );
+        size_t regbl_modified( 0 );
 
-            /* delimiter detection */
-            if ( ( regbl_line[regbl_head] == REGBL_DELIMITER ) || ( regbl_line[regbl_head] == '\0' ) ) {
+        /* selection index */
+        size_t regbl_select( 0 );
 
-                /* check index */
-                if ( ( regbl_index ++ ) == regbl_target ) {
+        /* store years */
+        std::vector< int32_t > regbl_year;
 
-                    /* extract entity */
-                    memcpy( regbl_token, regbl_line + regbl_tail, regbl_head - regbl_tail );
+        /* check multiple areas */
+        if ( regbl_multi == true ) {
 
-                    /* adding termination char */
-                    regbl_token[regbl_head - regbl_tail] = '\0';
+            /* display information */
+            std::cout << "Area : " << regbl_area.ar_path << std::endl;
 
-                    /* abort search */
-                    return;
+        }
+
+        /* display rows counters */
+        std::cout << "GEB database : " << regbl_area.ar_count.ct_read << " rows read, " << regbl_area.ar_count.ct_accept << " buildings accepted" << std::endl;
+        std::cout << "GEB database : " << regbl_area.ar_count.ct_filter << " rows rejected by bounding box, " << regbl_area.ar_count.ct_outside << " outside of slices, " << regbl_area.ar_count.ct_partial << " partially on slices, " << regbl_area.ar_count.ct_egid << " with non-numerical EGID" << std::endl;
+
+        /* parsing storage list */
+        for ( unsigned int regbl_parse = 0; regbl_parse < regbl_area.ar_list.size(); regbl_parse ++ ) {
+
+            /* push year */
+            regbl_year.push_back( regbl_area.ar_list[regbl_parse].fr_year );
+
+        }
+
+        /* export building store */
+        if ( lc_store_write( regbl_export_write, regbl_year, regbl_area.ar_building ) == false ) {
+
+            /* display message */
+            std::cerr << "error : unable to write in storage structure : store file" << regbl_suffix << std::endl;
+
+            /* abort */
+            exit( 1 );
+
+        }
+
+        /* check update mode */
+        if ( regbl_update == false ) {
+
+            /* remove outdated changes file - full processing */
+            std::filesystem::remove( regbl_export_change );
+
+        } else {
+
+            /* import updated building store */
+            if ( lc_store_open( regbl_export_write, regbl_current ) == false ) {
+
+                /* display message */
+                std::cerr << "error : unable to import updated building store" << regbl_suffix << std::endl;
+
+                /* abort */
+                exit( 1 );
+
+            }
+
+            /* compute changes between stores */
+            lc_change_compute( regbl_area.ar_previous, regbl_current, regbl_area.ar_change );
+
+            /* release building stores */
+            lc_store_close( regbl_area.ar_previous );
+            lc_store_close( regbl_current );
+
+            /* check pending changes - not yet processed */
+            if ( std::filesystem::exists( regbl_export_change ) == true ) {
+
+                /* import pending changes */
+                if ( lc_change_import( regbl_export_change, regbl_pending ) == false ) {
+
+                    /* display message */
+                    std::cerr << "error : unable to import pending changes file" << regbl_suffix << std::endl;
+
+                    /* abort */
+                    exit( 1 );
 
                 }
 
-                /* push new tail */
-                regbl_tail = regbl_head + 1;
+            }
+
+            /* merge pending changes with update changes */
+            lc_change_merge( regbl_pending, regbl_area.ar_change, regbl_merge );
+
+            /* export changes aside */
+            if ( lc_change_export( regbl_export_aside, regbl_merge ) == false ) {
+
+                /* display message */
+                std::cerr << "error : unable to write in storage structure : changes file" << regbl_suffix << std::endl;
+
+                /* abort */
+                exit( 1 );
+
+            }
+
+            /* replace changes file - before the store, keeping the changes recoverable */
+            std::filesystem::rename( regbl_export_aside, regbl_export_change );
+
+            /* replace building store */
+            std::filesystem::rename( regbl_export_write, regbl_export_store );
 
-                /* detect end of string */
-                if ( regbl_line[regbl_head] == '\0' ) {
+            /* parsing changes */
+            for ( lc_change_t const & regbl_entry : regbl_area.ar_change ) {
 
-                    /* update parser flag */
-                    regbl_parse = false;
+                /* update counters */
+                regbl_added    += ( regbl_entry.ch_type == LC_CHANGE_ADD    ) ? 1 : 0;
+                regbl_removed  += ( regbl_entry.ch_type == LC_CHANGE_REMOVE ) ? 1 : 0;
+                regbl_modified += ( regbl_entry.ch_type == LC_CHANGE_MODIFY ) ? 1 : 0;
+
+            }
+
+            /* display information */
+            std::cout << "Update : " << regbl_added << " added, " << regbl_removed << " removed, " << regbl_modified << " modified" << std::endl;
+
+        }
+
+        /* check legacy update */
+        if ( ( regbl_legacy == true ) && ( regbl_update == true ) ) {
+
+            /* remove files of removed and modified buildings */
+            regbl_bootstrap_legacy_remove( regbl_area.ar_change, regbl_export_egid, regbl_export_position, regbl_export_reference, regbl_export_surface, regbl_area.ar_list );
+
+            /* parsing buildings - both arrays sorted on egid */
+            for ( size_t regbl_parse = 0, regbl_entry = 0; regbl_parse < regbl_area.ar_building.size(); regbl_parse ++ ) {
+
+                /* search building change */
+                while ( ( regbl_entry < regbl_area.ar_change.size() ) && ( regbl_area.ar_change[regbl_entry].ch_egid < regbl_area.ar_building[regbl_parse].sb_egid ) ) regbl_entry ++;
+
+                /* check building change - added or modified */
+                if ( ( regbl_entry < regbl_area.ar_change.size() ) && ( regbl_area.ar_change[regbl_entry].ch_egid == regbl_area.ar_building[regbl_parse].sb_egid ) ) {
+
+                    /* keep building - self-move avoided */
+                    if ( regbl_select != regbl_parse ) regbl_area.ar_building[regbl_select] = std::move( regbl_area.ar_building[regbl_parse] );
+
+                    /* update selection index */
+                    regbl_select ++;
 
                 }
 
             }
 
-            /* update head */
-            regbl_head ++;
+            /* drop unchanged buildings */
+            regbl_area.ar_building.resize( regbl_select );
+
+        }
+
+        /* check legacy exportation */
+        if ( regbl_legacy == true ) {
+
+            /* create directories */
+            std::filesystem::create_directories( regbl_export_egid );
+            std::filesystem::create_directories( regbl_export_reference );
+            std::filesystem::create_directories( regbl_export_surface );
+
+            /* create year directories */
+            for ( unsigned int regbl_parse = 0; regbl_parse < regbl_area.ar_list.size(); regbl_parse ++ ) {
+
+                /* create directory */
+                std::filesystem::create_directories( regbl_export_position + "/" + regbl_area.ar_list[regbl_parse].fr_name );
+
+            }
+
+            /* export legacy storage structure */
+            regbl_bootstrap_legacy( regbl_area.ar_building, regbl_export_egid, regbl_export_position, regbl_export_reference, regbl_export_surface, regbl_area.ar_list );
 
         }
 
+        /* release area buildings */
+        std::vector< lc_store_building_t >().swap( regbl_area.ar_building );
+
     }
 
 /*
@@ -583,23 +1082,35 @@
         /* storage structure path */
         char * regbl_storage_path( lc_read_string( argc, argv, "--storage", "-s" ) );
 
+        /* areas list path */
+        char * regbl_areas_path( lc_read_string( argc, argv, "--areas", "-a" ) );
+
         /* GEB database path */
         char * regbl_GEB_path( lc_read_string( argc, argv, "--geb", "-g" ) );
 
         /* EIN database path */
         char * regbl_EIN_path( lc_read_string( argc, argv, "--ein", "-e" ) );
 
-        /* path composition */
-        std::string regbl_export_egid;
-        std::string regbl_export_position;
-        std::string regbl_export_surface;
-        std::string regbl_export_reference;
+        /* legacy exportation flag */
+        bool regbl_legacy( lc_read_flag( argc, argv, "--legacy", "-l" ) );
+
+        /* threads count */
+        int regbl_threads( lc_read_unsigned( argc, argv, "--threads", "-t", 1 ) );
+
+        /* update flag */
+        bool regbl_update( lc_read_flag( argc, argv, "--update", "-u" ) );
+
+        /* processing areas */
+        std::vector< regbl_area_t > regbl_area;
+
+        /* areas bounding boxes */
+        std::vector< lc_bound_t > regbl_bound;
 
-        /* storage list */
-        lc_list_t regbl_list;
+        /* areas grid index */
+        lc_grid_t regbl_grid;
 
         /* check path specification */
-        if ( regbl_storage_path == NULL ) {
+        if ( ( regbl_storage_path == NULL ) && ( regbl_areas_path == NULL ) ) {
 
             /* displays message */
             std::cerr << "error : storage path specification" << std::endl;
@@ -610,113 +1121,86 @@
         }
 
         /* check path specification */
-        if ( regbl_GEB_path == NULL ) {
+        if ( ( regbl_storage_path != NULL ) && ( regbl_areas_path != NULL ) ) {
 
             /* displays message */
-            std::cerr << "error : GEB database path specification" << std::endl;
+            std::cerr << "error : storage path and areas list can not be used together" << std::endl;
 
             /* send message */
             return( 1 );
 
         }
 
-        /* import storage list */
-        regbl_list = lc_list_import( std::string( regbl_storage_path ) + "/regbl_list" );
-
-        /* check storage list */
-        if ( regbl_list.size() == 0 ) {
+        /* check path specification */
+        if ( regbl_GEB_path == NULL ) {
 
-            /* display message */
-            std::cerr << "error : unable to import storage list file" << std::endl;
+            /* displays message */
+            std::cerr << "error : GEB database path specification" << std::endl;
 
             /* send message */
             return( 1 );
 
         }
 
-        /* compose path */
-        regbl_export_egid = std::string( regbl_storage_path ) + "/regbl_output/output_egid";
-
-        /* check directory */
-        if ( std::filesystem::is_directory( regbl_export_egid ) == false ) {
-
-            /* create directory */
-            std::filesystem::create_directories( regbl_export_egid );
+        /* check standard input usage */
+        if ( ( regbl_EIN_path != NULL ) && ( std::string( regbl_GEB_path ) == LC_TSV_STDIN ) && ( std::string( regbl_EIN_path ) == LC_TSV_STDIN ) ) {
 
-        } else {
-
-            /* display message */
-            std::cerr << "error : egid directory already processed" << std::endl;
+            /* displays message */
+            std::cerr << "error : standard input can only provide one database" << std::endl;
 
             /* send message */
             return( 1 );
 
         }
 
-        /* compose path */
-        regbl_export_position = std::string( regbl_storage_path ) + "/regbl_output/output_position";
+        /* check areas list */
+        if ( regbl_areas_path != NULL ) {
 
-        /* check directory */
-        if ( std::filesystem::is_directory( regbl_export_position ) == false ) {
+            /* import areas list */
+            if ( regbl_bootstrap_areas( regbl_areas_path, regbl_area ) == false ) {
 
-            /* create year directories */
-            for ( unsigned int regbl_parse = 0; regbl_parse < regbl_list.size(); regbl_parse ++ ) {
+                /* displays message */
+                std::cerr << "error : unable to import areas list or duplicated area" << std::endl;
 
-                /* create directory */
-                std::filesystem::create_directories( regbl_export_position + "/" + regbl_list[regbl_parse][0] );
+                /* send message */
+                return( 1 );
 
             }
 
         } else {
 
-            /* display message */
-            std::cerr << "error : position directory already processed" << std::endl;
+            /* push single area */
+            regbl_area.emplace_back();
 
-            /* send message */
-            return( 1 );
+            /* assign area storage path */
+            regbl_area.back().ar_path = regbl_storage_path;
 
         }
 
-        /* compose path */
-        regbl_export_reference = std::string( regbl_storage_path ) + "/regbl_output/output_reference";
-
-        /* check directory */
-        if ( std::filesystem::is_directory( regbl_export_reference ) == false ) {
-
-            /* create directory */
-            std::filesystem::create_directories( regbl_export_reference );
+        /* check threads count */
+        if ( regbl_threads == 0 ) {
 
-        } else {
-
-            /* display message */
-            std::cerr << "error : reference directory already processed" << std::endl;
-
-            /* send message */
-            return( 1 );
+            /* use all available threads */
+            regbl_threads = omp_get_max_threads();
 
         }
 
-        /* compose path */
-        regbl_export_surface = std::string( regbl_storage_path ) + "/regbl_output/output_surface";
+        /* parsing areas */
+        for ( regbl_area_t & regbl_entry : regbl_area ) {
 
-        /* check directory */
-        if ( std::filesystem::is_directory( regbl_export_surface ) == false ) {
+            /* prepare area - checks, list and index */
+            regbl_bootstrap_prepare( regbl_entry, regbl_legacy, regbl_update, regbl_areas_path != NULL );
 
-            /* create directory */
-            std::filesystem::create_directories( regbl_export_surface );
-
-        } else {
-
-            /* display message */
-            std::cerr << "error : surface directory already processed" << std::endl;
-
-            /* send message */
-            return( 1 );
+            /* push area bounding box */
+            regbl_bound.push_back( regbl_entry.ar_box );
 
         }
 
+        /* create areas grid index */
+        lc_grid_create( regbl_grid, regbl_bound );
+
         /* create main extraction - position, egid, reference */
-        regbl_bootstrap_extract( regbl_GEB_path, regbl_export_egid, regbl_export_position, regbl_export_reference, regbl_export_surface, regbl_list );
+        regbl_bootstrap_extract( regbl_GEB_path, regbl_area, regbl_grid, regbl_threads );
 
         /* check if entries database is specified */
         if ( regbl_EIN_path == NULL ) {
@@ -727,7 +1211,15 @@
         } else {
 
             /* create secondary extraction - entries position */
-            regbl_bootstrap_entries( regbl_EIN_path, regbl_export_egid, regbl_export_position, regbl_list );
+            regbl_bootstrap_entries( regbl_EIN_path, regbl_area, regbl_grid );
+
+        }
+
+        /* parsing areas */
+        for ( regbl_area_t & regbl_entry : regbl_area ) {
+
+            /* export area - store, changes and legacy */
+            regbl_bootstrap_export( regbl_entry, regbl_legacy, regbl_update, regbl_areas_path != NULL );
 
         }
 
@@ -55,20 +55,16 @@
     # include <iostream>    
     # include <string>
     # include <vector>
+    # include <cstdint>
     # include <fstream>
     # include <filesystem>
+    # include <omp.h>
     # include <common-include.hpp>
 
 /*
     header - preprocessor definitions
  */
 
-    /* define string buffer length */
-    # define REGBL_BUFFER 8192
-
-    /* define delimiter */
-    # define REGBL_DELIMITER '\t'
-
 /*
     header - preprocessor macros
  */
@@ -83,107 +79,230 @@
     header - structures
  */
 
+    /*! \struct regbl_count_struct
+     *  \brief Extraction counters structure
+     *
+     *  This structure holds the counters of the GEB database rows, according
+     *  to the way they are handled by the extraction.
+     *
+     *  \var regbl_count_struct::ct_read
+     *  Rows read
+     *  \var regbl_count_struct::ct_filter
+     *  Rows rejected by the slices bounding box, without splitting
+     *  \var regbl_count_struct::ct_outside
+     *  Rows rejected as outside of all slices
+     *  \var regbl_count_struct::ct_partial
+     *  Rows rejected as partially appearing on the slices
+     *  \var regbl_count_struct::ct_egid
+     *  Rows rejected as their EGID is not numerical
+     *  \var regbl_count_struct::ct_accept
+     *  Rows accepted
+     */
+
+    typedef struct regbl_count_struct {
+
+        uint64_t ct_read;
+        uint64_t ct_filter;
+        uint64_t ct_outside;
+        uint64_t ct_partial;
+        uint64_t ct_egid;
+        uint64_t ct_accept;
+
+    } regbl_count_t;
+
+    /*! \struct regbl_area_struct
+     *  \brief Processing area structure
+     *
+     *  This structure holds the state of a processing area, that is a main
+     *  storage path with its 3D raster descriptor, along the extraction of the
+     *  RegBL databases. As the databases are read only once for all areas, the
+     *  buildings, their EGID index and the rows counters are kept for each
+     *  area until their exportation.
+     *
+     *  \var regbl_area_struct::ar_path
+     *  Main storage path
+     *  \var regbl_area_struct::ar_list
+     *  3D raster descriptor
+     *  \var regbl_area_struct::ar_box
+     *  Slices bounding box
+     *  \var regbl_area_struct::ar_building
+     *  Building structures array
+     *  \var regbl_area_struct::ar_index
+     *  Building EGID index
+     *  \var regbl_area_struct::ar_count
+     *  GEB database rows counters
+     *  \var regbl_area_struct::ar_previous
+     *  Previous building store, in update mode
+     *  \var regbl_area_struct::ar_change
+     *  Store changes, in update mode
+     */
+
+    typedef struct regbl_area_struct {
+
+        std::string                        ar_path;
+        lc_list_t                          ar_list;
+        lc_bound_t                         ar_box;
+        std::vector< lc_store_building_t > ar_building;
+        lc_hash_t                          ar_index;
+        regbl_count_t                      ar_count;
+        lc_store_t                         ar_previous;
+        std::vector< lc_change_t >         ar_change;
+
+    } regbl_area_t;
+
 /*
     header - function prototypes
  */
 
     /*! \brief Extraction methods
      *
-     * This function is responsible of extracting the information of building in
-     * the RegBL database provided through its path. The function reads the
-     * database entries and filter out the building that are not on the studied
-     * area. The filtering of the building based on their position is made using
-     * the 3D raster descriptor of the studied area.
-     *
-     * For each building, the position (EPSG:2056, E, N), the EGID, the surface
-     * (in square meters) and the construction date (when available) are
-     * extracted. The different information are dispatched and stored to ease
-     * accesses by subsequent processes.
-     *
-     * Both surface value and construction date can be missing for a building.
-     * In such a case, an empty string is exported in the storage file to inform
-     * the lack of information.
-     *
-     * \param regbl_GEB_path         Path of the RegBL GEB DSV file
-     * \param regbl_export_egid      Exportation path for EGID files
-     * \param regbl_export_position  Exportation path for positions
-     * \param regbl_export_reference Exportation path for construction date
-     * \param regbl_export_surface   Exportation path for surface values
-     * \param regbl_list             3D raster descriptor
+     * This function extracts the buildings of a chunk of the RegBL GEB database,
+     * given by the pointers on its first and past-the-end characters. For each
+     * line, only the coordinates fields are first located and converted. The
+     * areas that can contain the position are obtained from the grid index and
+     * the lines lying outside of their slices bounding box are rejected at this
+     * point. The other lines are split once, their position converted on each
+     * slice of each area, and the buildings fully appearing on an area are
+     * pushed in its array, in the order of the lines. The rows counters of the
+     * areas are updated along the way. The warnings are appended in the
+     * provided string and not displayed, allowing the caller to display them in
+     * the file order. When several areas are processed, the warnings end with
+     * the path of the concerned area.
+     *
+     * As chunks do not share any state, this function can be called on several
+     * chunks at the same time.
+     *
+     * \param regbl_head    Chunk first character
+     * \param regbl_tail    Chunk past-the-end character
+     * \param regbl_EGID    EGID field index
+     * \param regbl_GKODE   GKODE field index
+     * \param regbl_GKODN   GKODN field index
+     * \param regbl_GBAUJ   GBAUJ field index
+     * \param regbl_GAREA   GAREA field index
+     * \param regbl_area    Processing areas
+     * \param regbl_grid    Areas grid index
+     * \param regbl_chunk   Chunk building structures arrays, one per area
+     * \param regbl_warning Chunk warnings
+     * \param regbl_counter Chunk rows counters, one per area
      */
 
-    void regbl_bootstrap_extract( std::string regbl_GEB_path, std::string regbl_export_egid, std::string regbl_export_position, std::string regbl_export_reference, std::string regbl_export_surface, lc_list_t & regbl_list );
+    void regbl_bootstrap_extract_chunk( char const * regbl_head, char const * const regbl_tail, int const regbl_EGID, int const regbl_GKODE, int const regbl_GKODN, int const regbl_GBAUJ, int const regbl_GAREA, std::vector< regbl_area_t > const & regbl_area, lc_grid_t const & regbl_grid, std::vector< std::vector< lc_store_building_t > > & regbl_chunk, std::string & regbl_warning, std::vector< regbl_count_t > & regbl_counter );
+
+    void regbl_bootstrap_extract( std::string regbl_GEB_path, std::vector< lc_store_building_t > & regbl_building, lc_hash_t & regbl_index, lc_list_t & regbl_list, int const regbl_threads );
 
     /*! \brief Extraction methods
      *
      * This function is responsible of extracting the position of the building
      * entries, when available, and to link them to their respective building
      * using the EGID as link. A geographical filtering is performed to only
-     * consider entries that appear on the 3D raster. This is done using the 3D
-     * raster descriptor.
+     * consider entries that appear on the 3D raster of an area. This is done
+     * using the grid index and the 3D raster descriptor of the areas.
      *
      * This process parses then the RegBL EIN database to extract the entries   
      * position, taking into account that a building can have no, one or more
-     * entries. The EGID is used to link them to the extraction of building
-     * position.
+     * entries. The EGID hash table of each area containing the entry position
+     * is used to link them to the extraction of building position, the join
+     * being made in memory without any access to the storage.
      *
-     * It follows that this function will complete the position files computed
-     * by the function regbl_bootstrap_extract(), by appending the position of
-     * the entries to the already computed position file.
+     * It follows that this function will complete the building structures
+     * computed by the function regbl_bootstrap_extract(), by appending the
+     * position of the entries to the position of the building.
      *
-     * \param regbl_EIN_path         Path of the RegBL EIN DSV file
-     * \param regbl_export_position  Exportation path for positions
-     * \param regbl_list             3D raster descriptor
+     * \param regbl_EIN_path Path of the RegBL EIN DSV file
+     * \param regbl_area     Processing areas
+     * \param regbl_grid     Areas grid index
      */
 
-    void regbl_bootstrap_entries( std::string regbl_EIN_path, std::string regbl_export_egid, std::string regbl_export_position, lc_list_t & regbl_list );
+    void regbl_bootstrap_entries( std::string regbl_EIN_path, std::vector< regbl_area_t > & regbl_area, lc_grid_t const & regbl_grid );
 
-    /*! \brief Database methods
+    /*! \brief Exportation methods
      *
-     *  This function is used to compute the index of an DSV database entry
-     *  based on its header name. The header line of the considered database
-     *  has then to be provided. The DSV database is expected to use tabulation
-     *  as separator.
+     * This function exports the extracted buildings using the legacy storage
+     * structure, made of one file per building in each sub-directory. An empty
+     * file named after the EGID is created in the EGID directory, the position
+     * of the building and of its entries are written in the position directory
+     * of each year, the construction date is written in the reference directory
+     * when available and the surface is written in the surface directory.
      *
-     *  Considering the following DSV database header :
+     * \param regbl_building         Building structures array
+     * \param regbl_export_egid      Exportation path for EGID files
+     * \param regbl_export_position  Exportation path for positions
+     * \param regbl_export_reference Exportation path for construction date
+     * \param regbl_export_surface   Exportation path for surface values
+     * \param regbl_list             3D raster descriptor
+     */
+
+    void regbl_bootstrap_legacy( std::vector< lc_store_building_t > & regbl_building, std::string regbl_export_egid, std::string regbl_export_position, std::string regbl_export_reference, std::string regbl_export_surface, lc_list_t & regbl_list );
+
+    /*! \brief Exportation methods
      *
-     *      head_0 \t head_1 \t head_2
+     * This function removes, from the legacy storage structure, the files of
+     * the removed and modified buildings listed in the provided changes. It is
+     * used in update mode before the exportation of the added and modified
+     * buildings, ensuring that no outdated file remains, as the construction
+     * date and surface files are only written when available.
      *
-     *  and providing 'head_1' as entry target (entry name), the function
-     *  returns with index one.
+     * \param regbl_change           Changes list
+     * \param regbl_export_egid      Exportation path for EGID files
+     * \param regbl_export_position  Exportation path for positions
+     * \param regbl_export_reference Exportation path for construction date
+     * \param regbl_export_surface   Exportation path for surface values
+     * \param regbl_list             3D raster descriptor
+     */
+
+    void regbl_bootstrap_legacy_remove( std::vector< lc_change_t > const & regbl_change, std::string regbl_export_egid, std::string regbl_export_position, std::string regbl_export_reference, std::string regbl_export_surface, lc_list_t & regbl_list );
+
+    /*! \brief Area methods
      *
-     *  This function is used to analyse the DSV database header allowing to
-     *  subsequently use the regbl_detect_database_entry() function to reach
-     *  any entries with a simple index.
+     * This function imports the list of main storage paths to process in a
+     * single reading of the RegBL databases. The file gives one path per line,
+     * empty lines being ignored. An area is pushed in the provided array for
+     * each path.
      *
-     *  \param regbl_line   DSV database header line, using tabulation as separator
-     *  \param regbl_target Name of the entry in the DSV header
+     * \param regbl_areas_path Path of the areas list file
+     * \param regbl_area       Processing areas
      *
-     *  \return Index of the entry detected in the header using its name.
+     * \return Returns true on success, false if the file can not be read, is
+     * empty or gives the same path twice.
      */
 
-    int regbl_detect_database_header( char const * const regbl_line, char const * const regbl_target );
+    bool regbl_bootstrap_areas( std::string regbl_areas_path, std::vector< regbl_area_t > & regbl_area );
 
-    /*! \brief Database methods
+    /*! \brief Area methods
      *
-     *  This function is used to search in the database lines the element of the
-     *  table corresponding to the provided index. The line is expected to be
-     *  part of a DSV file using tabulation as separators. The index is used to
-     *  count the amount of element to jump over to reach the desired one.
+     * This function prepares a processing area before the extraction. The 3D
+     * raster descriptor is imported and the state of the storage structure is
+     * checked according to the update and legacy modes, the previous building
+     * store being opened in update mode. The slices bounding box and the EGID
+     * index of the area are then created.
      *
-     *  For example, providing the following line :
+     * As all areas are prepared before the extraction, an inconsistent area
+     * stops the program before the databases are read.
      *
-     *      entry_0 \t entry_1 \t entry_2
-     *
-     *  and one as index leads the function to select the 'entry_1' string. The
-     *  string is returned through the \b regbl_token string.
-     *
-     *  \param regbl_line   DSV database line, using tabulation as separator
-     *  \param regbl_target Index of the element to search
-     *  \param regbl_token  String through which the found entry is returned
+     * \param regbl_area   Processing area
+     * \param regbl_legacy Legacy exportation flag
+     * \param regbl_update Update mode flag
+     * \param regbl_multi  Multiple areas flag, adding the path to messages
+     */
+
+    void regbl_bootstrap_prepare( regbl_area_t & regbl_area, bool const regbl_legacy, bool const regbl_update, bool const regbl_multi );
+
+    /*! \brief Area methods
+     *
+     * This function exports the extraction of a processing area. The rows
+     * counters are displayed and the building store is written. In update mode,
+     * the changes with the previous store are computed and exported before the
+     * previous store is replaced. The legacy storage structure is finally
+     * exported or updated when requested. The buildings of the area are
+     * released.
+     *
+     * \param regbl_area   Processing area
+     * \param regbl_legacy Legacy exportation flag
+     * \param regbl_update Update mode flag
+     * \param regbl_multi  Multiple areas flag, adding the path to messages
      */
 
-    void regbl_detect_database_entry( char const * const regbl_line, int const regbl_target, char * const regbl_token );
+    void regbl_bootstrap_export( regbl_area_t & regbl_area, bool const regbl_legacy, bool const regbl_update, bool const regbl_multi );
 
     /*! \brief Main function
      *
@@ -191,26 +310,62 @@
      * 3D raster processing for building construction deduction :
      *
      *     ./regbl-bootstrap --storage/-s Main storage path
+     *                       --areas/-a Main storage paths list file
      *                       --geb/-g RegBL GEB DSV file path
      *                       --ein/-e RegBL EIN DSV file path
+     *                       --legacy/-l Legacy directories exportation
+     *                       --threads/-t Amount of threads (0 for all)
+     *                       --update/-u Update from a new RegBL release
      *
      * The first parameter gives the main storage path, that is the directory in
      * with all the processing steps data will be exported and gathered.
      *
+     * Instead of a single main storage path, a file listing one main storage
+     * path per line can be provided. The databases are then read only once,
+     * each building being routed to all the areas it appears on, using a
+     * coarse grid index of the areas bounding boxes. Each area is then
+     * processed as it would be alone, its rows counters being displayed after
+     * its path and its messages ending with it.
+     *
      * The two path provided to the program have to point to the GEB and EIN DSV
-     * file of the RegBL database. Be sure to specify the 'Data' one. The EIN
-     * database can be omitted. In such a case, the entries of the building are
-     * not extracted, and then, will not be used by any of the subsequent
-     * processes.
+     * file of the RegBL database. Be sure to specify the 'Data' one. The files
+     * can be gzip-compressed and one of them can be read from the standard
+     * input using '-' as path. The EIN database can be omitted. In such a
+     * case, the entries of the building are not extracted, and then, will not
+     * be used by any of the subsequent processes.
      *
-     * The program then initialises the main storage directory by creating all
-     * the required sub-directories. It then starts reading the GEB database
-     * entries to extract each building position, EGID, construction date and
-     * surface values.
+     * The program starts reading the GEB database entries to extract each
+     * building position, EGID, construction date and surface values. This
+     * reading can be spread over several threads, the result being the same
+     * as the one obtained with a single thread.
      *
      * This done, the program reads the EIN database to extract the available
      * building entries and links them to their respective building.
      *
+     * The extracted information are then written in the building store file,
+     * a single binary file that subsequent processes map in memory :
+     *
+     *     .../regbl_output/output_store
+     *
+     * When the legacy flag is provided, the information are also exported in
+     * the legacy storage structure, made of one file per building in the
+     * output_egid, output_position, output_reference and output_surface
+     * sub-directories.
+     *
+     * When the update flag is provided, the building store has to exist. The
+     * new store is written aside and compared to the previous one to compute
+     * the added, removed and modified buildings. They are merged with the
+     * changes of a previous update still found in the changes file, written
+     * aside and swapped with the changes file before the previous store is
+     * replaced :
+     *
+     *     .../regbl_output/output_change
+     *
+     * The subsequent processes can then reprocess only the changed buildings.
+     * With the legacy flag, the legacy directories are updated by removing the
+     * files of removed and modified buildings and by exporting the added and
+     * modified ones. Without update flag, an outdated changes file is removed.
+     *
      * A geographical filtering is performed base on the building position and
      * on the entries position themselves in order to keep only the building
      * that appear on each 2D slice of the 3D raster. This program then needs
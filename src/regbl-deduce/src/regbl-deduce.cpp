@@ -154,14 +154,31 @@
         /* storage structure path */
         char * regbl_storage_path( lc_read_string( argc, argv, "--storage", "-s" ) );
 
+        /* update flag */
+        bool regbl_update( lc_read_flag( argc, argv, "--update", "-u" ) );
+
+        /* shards merge count */
+        uint64_t regbl_merge( lc_read_unsigned( argc, argv, "--merge", "-m", 0 ) );
+
+        /* buildings shard */
+        lc_shard_t regbl_shard;
+
         /* egid value */
         std::string regbl_egid;
 
+        /* store changes */
+        std::vector< lc_change_t > regbl_change;
+
+        /* removal error */
+        std::error_code regbl_error;
+
         /* path composition */
-        std::string regbl_export_egid;
         std::string regbl_export_detect;
         std::string regbl_export_deduce;
 
+        /* building store */
+        lc_store_t regbl_store;
+
         /* check path specification */
         if ( regbl_storage_path == NULL ) {
 
@@ -173,14 +190,41 @@
 
         }
 
-        /* compose path */
-        regbl_export_egid = std::string( regbl_storage_path ) + "/regbl_output/output_egid";
+        /* read shard specification */
+        if ( lc_shard_read( argc, argv, "--shard", "-p", regbl_shard ) == false ) {
 
-        /* check consistency */
-        if ( std::filesystem::is_directory( regbl_export_egid ) == false ) {
+            /* display message */
+            std::cerr << "error : invalid shard specification" << std::endl;
+
+            /* send message */
+            return( 1 );
+
+        }
+
+        /* check merge mode */
+        if ( regbl_merge > 0 ) {
+
+            /* merge shards deduction files */
+            if ( lc_shard_merge( std::string( regbl_storage_path ) + "/regbl_output/output_deduce", regbl_merge ) == false ) {
+
+                /* display message */
+                std::cerr << "error : unable to merge deduction shards" << std::endl;
+
+                /* send message */
+                return( 1 );
+
+            }
+
+            /* send message */
+            return( 0 );
+
+        }
+
+        /* import building store */
+        if ( lc_store_open( std::string( regbl_storage_path ) + "/regbl_output/output_store", regbl_store ) == false ) {
 
             /* display message */
-            std::cerr << "error : unable to locate egid directory" << std::endl;
+            std::cerr << "error : unable to import building store" << std::endl;
 
             /* send message */
             return( 1 );
@@ -191,7 +235,7 @@
         regbl_export_detect = std::string( regbl_storage_path ) + "/regbl_output/output_detect";
 
         /* check consistency */
-        if ( std::filesystem::is_directory( regbl_export_egid ) == false ) {
+        if ( std::filesystem::is_directory( regbl_export_detect ) == false ) {
 
             /* display message */
             std::cerr << "error : unable to locate detect directory" << std::endl;
@@ -204,38 +248,95 @@
         /* compose path */
         regbl_export_deduce = std::string( regbl_storage_path ) + "/regbl_output/output_deduce";
 
-        /* check consistency */
-        if ( std::filesystem::is_directory( regbl_export_deduce ) == false ) {
+        /* check update mode */
+        if ( regbl_update == false ) {
 
-            /* create directory */
-            std::filesystem::create_directories( regbl_export_deduce );
+            /* compose shard path */
+            regbl_export_deduce = lc_shard_path( regbl_export_deduce, regbl_shard );
 
-        } else {
+            /* check consistency */
+            if ( std::filesystem::is_directory( regbl_export_deduce ) == false ) {
 
-            /* display message */
-            std::cerr << "error : deduce directory already processed" << std::endl;
+                /* create directory */
+                std::filesystem::create_directories( regbl_export_deduce );
 
-            /* send message */
-            return( 1 );
+            } else {
 
-        }
+                /* display message */
+                std::cerr << "error : deduce directory already processed" << std::endl;
+
+                /* send message */
+                return( 1 );
+
+            }
 
-        /* parsing egid */
-        for ( const std::filesystem::directory_entry & regbl_file : std::filesystem::directory_iterator( regbl_export_egid ) ) {
+            /* parsing store buildings */
+            for ( uint64_t regbl_building = 0; regbl_building < regbl_store.st_count; regbl_building ++ ) {
 
-            /* check for regular file */
-            if ( regbl_file.is_regular_file() == true ) {
+                /* check building shard */
+                if ( lc_shard_member( regbl_shard, regbl_store.st_egid[regbl_building] ) == false ) continue;
 
                 /* extract egid */
-                regbl_egid = regbl_file.path().filename();
+                regbl_egid = std::to_string( regbl_store.st_egid[regbl_building] );
 
                 /* deduction process */
-                regbl_deduce_detect( regbl_export_detect + "/" + regbl_egid, regbl_export_deduce + "/" + regbl_egid );                
+                regbl_deduce_detect( regbl_export_detect + "/" + regbl_egid, regbl_export_deduce + "/" + regbl_egid );
+
+            }
+
+        } else {
+
+            /* check consistency */
+            if ( std::filesystem::is_directory( regbl_export_deduce ) == false ) {
+
+                /* display message */
+                std::cerr << "error : unable to locate deduce directory for update" << std::endl;
+
+                /* send message */
+                return( 1 );
+
+            }
+
+            /* import store changes */
+            if ( lc_change_import( std::string( regbl_storage_path ) + "/regbl_output/output_change", regbl_change ) == false ) {
+
+                /* display message */
+                std::cerr << "error : unable to import changes file" << std::endl;
+
+                /* send message */
+                return( 1 );
+
+            }
+
+            /* parsing changes */
+            for ( lc_change_t const & regbl_entry : regbl_change ) {
+
+                /* check building shard */
+                if ( lc_shard_member( regbl_shard, regbl_entry.ch_egid ) == false ) continue;
+
+                /* extract egid */
+                regbl_egid = std::to_string( regbl_entry.ch_egid );
+
+                /* check change type */
+                if ( regbl_entry.ch_type == LC_CHANGE_REMOVE ) {
+
+                    /* remove outdated deduction file */
+                    std::filesystem::remove( regbl_export_deduce + "/" + regbl_egid, regbl_error );
+
+                } else {
+
+                    /* deduction process */
+                    regbl_deduce_detect( regbl_export_detect + "/" + regbl_egid, regbl_export_deduce + "/" + regbl_egid );
+
+                }
 
             }
 
         }
 
+        /* release building store */
+        lc_store_close( regbl_store );
+
         /* send message */
         return( 0 );
 
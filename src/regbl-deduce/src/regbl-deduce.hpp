@@ -121,10 +121,26 @@
      * construction date based on their detection file :
      *
      *     ./regbl-deduce --storage/-s path of the main storage directory
+     *                    --update/-u reprocess changed buildings only
+     *                    --shard/-p Buildings shard (i/n)
+     *                    --merge/-m Merge the outputs of the provided amount
+     *                               of shards
      *
-     * The main function starts by listing all the available detection files for
-     * the studied geographical area (covered by the 3D raster). For each file,
-     * it applies the deduction process.
+     * The main function starts by mapping the building store of the studied
+     * geographical area (covered by the 3D raster). For each building of the
+     * store, it applies the deduction process on its detection file.
+     *
+     * With the update flag, the deduction directory has to exist and the
+     * changes file written by the bootstrap update is imported. The deduction
+     * is then only applied on the added and modified buildings, the deduction
+     * files of the removed buildings being removed.
+     *
+     * With the shard specification, only the buildings of the shard i over n
+     * are deduced (see the lc_shard_t structure), the deduction files being
+     * written in the output_deduce_i_n directory. A last run with the merge
+     * option moves the files of all the shards in the deduction directory
+     * (see lc_shard_merge()). In update mode, each shard directly updates the
+     * deduction files of its buildings.
      *
      * \param argc Standard parameter
      * \param argv Standard parameter
@@ -25,91 +25,235 @@
     source - Detection methods
  */
 
-    bool regbl_detect_on_map( cv::Mat & regbl_map, int * const regbl_x, int * const regbl_y ) {
-
-        /* detection cross pattern */
-        static const int regbl_cross[29][2] = {
-
-            { -3, +0 },
-            { -2, -2 },
-            { -2, -1 },
-            { -2, +0 },
-            { -2, +1 },
-            { -2, +2 },
-            { -1, -2 },
-            { -1, -1 },
-            { -1, +0 },
-            { -1, +1 },
-            { -1, +2 },
-            { +0, -3 },
-            { +0, -2 },
-            { +0, -1 },
-            { +0, +0 },
-            { +0, +1 },
-            { +0, +2 },
-            { +0, +3 },
-            { +1, -2 },
-            { +1, -1 },
-            { +1, +0 },
-            { +1, +1 },
-            { +1, +2 },
-            { +2, -2 },
-            { +2, -1 },
-            { +2, +0 },
-            { +2, +1 },
-            { +2, +2 },
-            { +3, +0 }
-
-        };
-
-        /* detection coordinates */
-        int regbl_u( 0. );
-        int regbl_v( 0. );
-        
-        /* parsing detection cross */
-        for ( int regbl_i = 0; regbl_i < 29; regbl_i ++ ) {
-
-            /* compute detection coordinates */
-            regbl_u = ( * regbl_x ) + regbl_cross[regbl_i][0];
-            regbl_v = ( * regbl_y ) + regbl_cross[regbl_i][1];
-
-            /* check coordinates */
-            if ( regbl_u < 0 ) continue;
-            if ( regbl_v < 0 ) continue;
-
-            /* check coordinates */
-            if ( regbl_u >= regbl_map.cols ) continue;
-            if ( regbl_v >= regbl_map.rows ) continue;
-
-            /* formal detection */
-            if ( regbl_map.at<uchar>( regbl_v, regbl_u ) == 0 ) {
-
-                /* assign formal detection position */
-                ( * regbl_x ) = regbl_u;
-                ( * regbl_y ) = regbl_v;
-
-                /* send results */
-                return( true );
+    void regbl_detect_nearest( cv::Mat const & regbl_map, cv::Mat & regbl_nearest, int const regbl_threads ) {
+
+        /* map size */
+        int64_t regbl_width( regbl_map.cols );
+        int64_t regbl_height( regbl_map.rows );
+
+        /* distance beyond any map distance - column without black pixel */
+        int64_t regbl_far( regbl_width + regbl_height );
+
+        /* create nearest pixel map */
+        regbl_nearest.create( regbl_map.rows, regbl_map.cols, CV_32S );
+
+        /* nearest black pixel row of each column - last one met by the scans */
+        std::vector< int32_t > regbl_last( regbl_width );
+
+        /* parsing columns strips - nearest black pixel row in each column */
+        # pragma omp parallel for schedule(static) num_threads(regbl_threads)
+        for ( int regbl_strip = 0; regbl_strip < regbl_threads; regbl_strip ++ ) {
+
+            /* strip columns range */
+            int64_t regbl_begin( ( regbl_width * regbl_strip ) / regbl_threads );
+            int64_t regbl_end( ( regbl_width * ( regbl_strip + 1 ) ) / regbl_threads );
+
+            /* reset nearest black pixel rows */
+            std::fill( regbl_last.begin() + regbl_begin, regbl_last.begin() + regbl_end, -1 );
+
+            /* parsing rows - downward */
+            for ( int64_t regbl_v = 0; regbl_v < regbl_height; regbl_v ++ ) {
+
+                /* rows pointers */
+                uchar const * regbl_pixel( regbl_map.ptr<uchar>( regbl_v ) );
+                int32_t * regbl_row( regbl_nearest.ptr<int32_t>( regbl_v ) );
+
+                /* parsing strip columns */
+                for ( int64_t regbl_u = regbl_begin; regbl_u < regbl_end; regbl_u ++ ) {
+
+                    /* update nearest black pixel row */
+                    if ( regbl_pixel[regbl_u] == 0 ) regbl_last[regbl_u] = regbl_v;
+
+                    /* assign nearest black pixel row above */
+                    regbl_row[regbl_u] = regbl_last[regbl_u];
+
+                }
+
+            }
+
+            /* reset nearest black pixel rows */
+            std::fill( regbl_last.begin() + regbl_begin, regbl_last.begin() + regbl_end, -1 );
+
+            /* parsing rows - upward */
+            for ( int64_t regbl_v = regbl_height - 1; regbl_v >= 0; regbl_v -- ) {
+
+                /* rows pointers */
+                uchar const * regbl_pixel( regbl_map.ptr<uchar>( regbl_v ) );
+                int32_t * regbl_row( regbl_nearest.ptr<int32_t>( regbl_v ) );
+
+                /* parsing strip columns */
+                for ( int64_t regbl_u = regbl_begin; regbl_u < regbl_end; regbl_u ++ ) {
+
+                    /* update nearest black pixel row */
+                    if ( regbl_pixel[regbl_u] == 0 ) regbl_last[regbl_u] = regbl_v;
+
+                    /* check black pixel below */
+                    if ( regbl_last[regbl_u] < 0 ) continue;
+
+                    /* check black pixel above */
+                    if ( ( regbl_row[regbl_u] < 0 ) || ( regbl_last[regbl_u] - regbl_v < regbl_v - regbl_row[regbl_u] ) ) {
+
+                        /* assign nearest black pixel row below */
+                        regbl_row[regbl_u] = regbl_last[regbl_u];
+
+                    }
+
+                }
 
             }
 
         }
 
-        /* send results */
-        return( false );
+        /* parsing rows strips - lower envelope of the columns distances */
+        # pragma omp parallel for schedule(static) num_threads(regbl_threads)
+        for ( int regbl_strip = 0; regbl_strip < regbl_threads; regbl_strip ++ ) {
+
+            /* strip rows range */
+            int64_t regbl_begin( ( regbl_height * regbl_strip ) / regbl_threads );
+            int64_t regbl_end( ( regbl_height * ( regbl_strip + 1 ) ) / regbl_threads );
+
+            /* columns squared distances - strip buffer */
+            std::vector< int64_t > regbl_dist( regbl_width );
+
+            /* envelope columns and their starting column - strip buffers */
+            std::vector< int64_t > regbl_column( regbl_width );
+            std::vector< int64_t > regbl_start( regbl_width );
+
+            /* nearest column - strip buffer */
+            std::vector< int64_t > regbl_near( regbl_width );
+
+            /* parsing strip rows */
+            for ( int64_t regbl_v = regbl_begin; regbl_v < regbl_end; regbl_v ++ ) {
+
+                /* row of nearest black pixel rows */
+                int32_t * regbl_row( regbl_nearest.ptr<int32_t>( regbl_v ) );
+
+                /* envelope index */
+                int64_t regbl_q( 0 );
+
+                /* separation column */
+                int64_t regbl_sep( 0 );
+
+                /* parsing row - columns squared distances */
+                for ( int64_t regbl_u = 0; regbl_u < regbl_width; regbl_u ++ ) {
+
+                    /* compute column distance */
+                    regbl_dist[regbl_u] = ( regbl_row[regbl_u] < 0 ) ? regbl_far : regbl_v - regbl_row[regbl_u];
+
+                    /* compute column squared distance */
+                    regbl_dist[regbl_u] *= regbl_dist[regbl_u];
+
+                }
+
+                /* initialise envelope */
+                regbl_column[0] = 0;
+                regbl_start[0] = 0;
+
+                /* parsing row - envelope construction */
+                for ( int64_t regbl_u = 1; regbl_u < regbl_width; regbl_u ++ ) {
+
+                    /* remove columns hidden by the current one */
+                    while ( ( regbl_q >= 0 ) && ( ( regbl_start[regbl_q] - regbl_column[regbl_q] ) * ( regbl_start[regbl_q] - regbl_column[regbl_q] ) + regbl_dist[regbl_column[regbl_q]] > ( regbl_start[regbl_q] - regbl_u ) * ( regbl_start[regbl_q] - regbl_u ) + regbl_dist[regbl_u] ) ) regbl_q --;
+
+                    /* check envelope */
+                    if ( regbl_q < 0 ) {
+
+                        /* restart envelope */
+                        regbl_column[regbl_q = 0] = regbl_u;
+
+                    } else {
+
+                        /* compute separation numerator */
+                        regbl_sep = regbl_u * regbl_u - regbl_column[regbl_q] * regbl_column[regbl_q] + regbl_dist[regbl_u] - regbl_dist[regbl_column[regbl_q]];
+
+                        /* compute first column of the current one - rounded down */
+                        regbl_sep = 1 + ( regbl_sep / ( 2 * ( regbl_u - regbl_column[regbl_q] ) ) ) - ( ( ( regbl_sep < 0 ) && ( regbl_sep % ( 2 * ( regbl_u - regbl_column[regbl_q] ) ) != 0 ) ) ? 1 : 0 );
+
+                        /* check separation */
+                        if ( regbl_sep < regbl_width ) {
+
+                            /* push column on envelope */
+                            regbl_column[++ regbl_q] = regbl_u;
+                            regbl_start[regbl_q] = regbl_sep;
+
+                        }
+
+                    }
+
+                }
+
+                /* parsing row - envelope reading */
+                for ( int64_t regbl_u = regbl_width - 1; regbl_u >= 0; regbl_u -- ) {
+
+                    /* assign nearest column */
+                    regbl_near[regbl_u] = regbl_column[regbl_q];
+
+                    /* update envelope index */
+                    if ( regbl_u == regbl_start[regbl_q] ) regbl_q --;
+
+                }
+
+                /* parsing row - nearest black pixels */
+                for ( int64_t regbl_u = 0; regbl_u < regbl_width; regbl_u ++ ) {
+
+                    /* compose nearest pixel index */
+                    regbl_near[regbl_u] = ( regbl_dist[regbl_near[regbl_u]] == regbl_far * regbl_far ) ? -1 : regbl_row[regbl_near[regbl_u]] * regbl_width + regbl_near[regbl_u];
+
+                }
+
+                /* parsing row - assign nearest black pixels */
+                for ( int64_t regbl_u = 0; regbl_u < regbl_width; regbl_u ++ ) {
+
+                    /* assign nearest pixel index */
+                    regbl_row[regbl_u] = regbl_near[regbl_u];
+
+                }
+
+            }
+
+        }
 
     }
 
-    void regbl_detect( cv::Mat & regbl_map, cv::Mat & regbl_track, cv::Mat & regbl_mask, std::string & regbl_export_egid, std::string & regbl_export_position, std::string & regbl_export_detect, std::string & regbl_year ) {
+    bool regbl_detect_on_map( cv::Mat const & regbl_nearest, double const regbl_radius, int * const regbl_x, int * const regbl_y ) {
 
-        /* input stream */
-        std::ifstream regbl_input;
+        /* nearest black pixel index */
+        int32_t regbl_pixel( 0 );
 
-        /* output stream */
-        std::ofstream regbl_output;
+        /* nearest black pixel coordinates */
+        int regbl_u( 0 );
+        int regbl_v( 0 );
+
+        /* check coordinates */
+        if ( ( ( * regbl_x ) < 0 ) || ( ( * regbl_x ) >= regbl_nearest.cols ) ) return( false );
+        if ( ( ( * regbl_y ) < 0 ) || ( ( * regbl_y ) >= regbl_nearest.rows ) ) return( false );
 
-        /* egid value */
-        std::string regbl_egid;
+        /* retrieve nearest black pixel */
+        if ( ( regbl_pixel = regbl_nearest.at<int32_t>( * regbl_y, * regbl_x ) ) < 0 ) return( false );
+
+        /* compute nearest black pixel coordinates */
+        regbl_u = regbl_pixel % regbl_nearest.cols;
+        regbl_v = regbl_pixel / regbl_nearest.cols;
+
+        /* check detection radius */
+        if ( double( ( regbl_u - ( * regbl_x ) ) * ( regbl_u - ( * regbl_x ) ) + ( regbl_v - ( * regbl_y ) ) * ( regbl_v - ( * regbl_y ) ) ) > regbl_radius * regbl_radius ) return( false );
+
+        /* assign formal detection position */
+        ( * regbl_x ) = regbl_u;
+        ( * regbl_y ) = regbl_v;
+
+        /* send results */
+        return( true );
+
+    }
+
+    void regbl_detect_chunk( cv::Mat const & regbl_nearest, double const regbl_radius, cv::Mat const & regbl_label, cv::Mat const & regbl_stat, lc_store_t const & regbl_store, std::vector< uint64_t > const & regbl_select, uint32_t const regbl_index, size_t const regbl_begin, size_t const regbl_end, bool const regbl_overlay, std::vector< regbl_result_t > & regbl_result, std::vector< lc_mark_t > & regbl_mark ) {
+
+        /* building points */
+        int32_t const * regbl_point( NULL );
+
+        /* building points count */
+        uint64_t regbl_count( 0 );
 
         /* position coordinates */
         int regbl_x( 0. );
@@ -117,138 +261,424 @@
 
         /* detection statistic */
         int regbl_found( 0 );
-        int regbl_total( 0 );
 
         /* detection connected area */
         int regbl_area( 0 );
 
-        /* detection loop flag */
-        bool regbl_flag( true );
+        /* parsing chunk selected store buildings */
+        for ( size_t regbl_entry = regbl_begin; regbl_entry < regbl_end; regbl_entry ++ ) {
 
-        /* cross color */
-        cv::Scalar regbl_color;
+            /* retrieve building points */
+            regbl_point = lc_store_get_position( regbl_store, regbl_index, regbl_select[regbl_entry] );
 
-        /* parsing egid directory */
-        for ( const std::filesystem::directory_entry & regbl_file : std::filesystem::directory_iterator( regbl_export_egid ) ) {
+            /* retrieve building points count */
+            regbl_count = lc_store_get_count( regbl_store, regbl_select[regbl_entry] );
 
-            /* check for regular file */
-            if ( regbl_file.is_regular_file() == true ) {
+            /* reset statistic */
+            regbl_found = 0;
 
-                /* extract egid */
-                regbl_egid = regbl_file.path().filename();
+            /* parsing positions */
+            for ( uint64_t regbl_parse = 0; ( regbl_parse < regbl_count ) && ( regbl_found == 0 ); regbl_parse ++ ) {
 
-                /* create input stream */
-                regbl_input.open( regbl_export_position + "/" + regbl_year + "/" + regbl_egid, std::ifstream::in );
+                /* import position from store */
+                regbl_x = regbl_point[regbl_parse * 2 + 0];
+                regbl_y = regbl_point[regbl_parse * 2 + 1];
 
-                /* check input stream */
-                if ( regbl_input.is_open() == false ) {
+                /* detection on map */
+                if ( regbl_detect_on_map( regbl_nearest, regbl_radius, & regbl_x, & regbl_y ) == true ) {
 
-                    /* display message */
-                    std::cerr << "error : unable to access position file" << std::endl;
+                    /* update statistic */
+                    regbl_found ++;
 
-                    /* send message */
-                    exit( 1 );
+                }
+
+                /* check overlay */
+                if ( regbl_overlay == true ) {
+
+                    /* buffer detection mark */
+                    regbl_mark.push_back( { regbl_x, regbl_y, regbl_found > 0 } );
 
                 }
 
-                /* reset statistic */
-                regbl_found = 0;
-                regbl_total = 0;
+            }
 
-                /* reset loop flag */
-                regbl_flag = true;
+            /* check if a detection was made */
+            if ( regbl_found > 0 ) {
 
-                /* parsing positions */
-                while ( ( regbl_flag == true ) && ( regbl_found == 0 ) ) {
+                /* retrieve size of the building connected area */
+                regbl_area = regbl_stat.at<int>( regbl_label.at<int>( regbl_y, regbl_x ), cv::CC_STAT_AREA );
 
-                    /* import position from file */
-                    if ( regbl_input >> regbl_x >> regbl_y ) {
+            } else {
 
-                        /* detection on map */
-                        if ( regbl_detect_on_map( regbl_map, & regbl_x, & regbl_y ) == true ) {
+                /* assign a zero size */
+                regbl_area = 0;
 
-                            /* update statistic */
-                            regbl_found ++;
+            }
 
-                            /* update color */
-                            regbl_color = cv::Scalar( 0, 255, 0, 255 );
+            /* assign detection result */
+            regbl_result[regbl_entry].rs_found = ( regbl_found > 0 );
+            regbl_result[regbl_entry].rs_x     = regbl_x;
+            regbl_result[regbl_entry].rs_y     = regbl_y;
+            regbl_result[regbl_entry].rs_area  = regbl_area;
 
-                        } else {
+        }
 
-                            /* update color */
-                            regbl_color = cv::Scalar( 0, 0, 255, 255 );
+    }
 
-                        }
+    void regbl_detect( cv::Mat const & regbl_nearest, double const regbl_radius, cv::Mat const & regbl_label, cv::Mat const & regbl_stat, lc_store_t const & regbl_store, std::vector< uint64_t > const & regbl_select, uint32_t const regbl_index, std::vector< regbl_result_t > & regbl_result, bool const regbl_overlay, std::vector< lc_mark_t > & regbl_mark, int const regbl_threads ) {
 
-                        /* mark detection on tacking map */
-                        cv::line( regbl_track, cv::Point( regbl_x    , regbl_y - 3 ), cv::Point( regbl_x    , regbl_y + 3 ), regbl_color );
-                        cv::line( regbl_track, cv::Point( regbl_x - 3, regbl_y     ), cv::Point( regbl_x + 3, regbl_y     ), regbl_color );
+        /* chunks count - four per thread for balancing */
+        size_t regbl_chunks( ( regbl_threads > 1 ) ? regbl_threads * 4 : 1 );
 
-                        /* update total */
-                        regbl_total ++;
+        /* chunks marks */
+        std::vector< std::vector< lc_mark_t > > regbl_buffer( regbl_chunks );
 
-                    } else {
+        /* allocate results - one per selected building */
+        regbl_result.resize( regbl_select.size() );
 
-                        /* update loop flag */
-                        regbl_flag = false;
+        /* parsing chunks - disjoint results ranges */
+        # pragma omp parallel for schedule(dynamic) num_threads(regbl_threads)
+        for ( size_t regbl_chunk = 0; regbl_chunk < regbl_chunks; regbl_chunk ++ ) {
 
-                    }
+            /* perform detection on chunk buildings */
+            regbl_detect_chunk( regbl_nearest, regbl_radius, regbl_label, regbl_stat, regbl_store, regbl_select, regbl_index, ( regbl_select.size() * regbl_chunk ) / regbl_chunks, ( regbl_select.size() * ( regbl_chunk + 1 ) ) / regbl_chunks, regbl_overlay, regbl_result, regbl_buffer[regbl_chunk] );
 
-                }
+        }
 
-                /* check total consistency */
-                if ( regbl_total == 0 ) {
+        /* reset marks */
+        regbl_mark.clear();
 
-                    /* display message */
-                    std::cerr << "error : unable to import position from position file" << std::endl;
+        /* parsing chunks marks - selection order */
+        for ( std::vector< lc_mark_t > const & regbl_entry : regbl_buffer ) {
 
-                    /* send message */
-                    exit( 1 );
+            /* append chunk marks */
+            regbl_mark.insert( regbl_mark.end(), regbl_entry.begin(), regbl_entry.end() );
 
-                } else {
+        }
 
-                    /* check if a detection was made */
-                    if ( regbl_found > 0 ) {
+    }
 
-                        /* compute size of the building connected area */
-                        regbl_area = lc_connect_get_size( regbl_map, regbl_mask, regbl_x, regbl_y, true );
+    bool regbl_detect_year( std::string regbl_storage_path, lc_frame_t & regbl_frame, uint32_t const regbl_index, lc_cube_t const & regbl_cube, lc_store_t & regbl_store, std::vector< uint64_t > const & regbl_select, double const regbl_radius, int const regbl_overlay, std::string & regbl_export_frame, std::vector< regbl_result_t > & regbl_result, int const regbl_threads ) {
 
-                    } else {
+        /* raster image */
+        cv::Mat regbl_map;
+        cv::Mat regbl_nearest;
+        cv::Mat regbl_track;
+
+        /* detection marks */
+        std::vector< lc_mark_t > regbl_mark;
+
+        /* connected components */
+        cv::Mat regbl_seed;
+        cv::Mat regbl_label;
+        cv::Mat regbl_stat;
+        cv::Mat regbl_centroid;
+
+        /* display information */
+        # pragma omp critical( regbl_detect_message )
+        std::cout << "Processing year " << regbl_frame.fr_name << " ..." << std::endl;
+
+        /* check cube availability */
+        if ( regbl_cube.cb_base != NULL ) {
+
+            /* extract year map from cube */
+            lc_cube_get_map( regbl_cube, regbl_index, regbl_map );
+
+        } else {
+
+            /* import year map */
+            regbl_map = cv::imread( regbl_storage_path + "/regbl_frame/frame/" + regbl_frame.fr_name + ".tif", cv::IMREAD_GRAYSCALE );
+
+        }
+
+        /* check year map importation */
+        if ( regbl_map.empty() == true ) {
+
+            /* display message */
+            # pragma omp critical( regbl_detect_message )
+            std::cerr << "error : unable to import map for year " << regbl_frame.fr_name << std::endl;
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* check map and list consistency */
+        if ( ( regbl_frame.fr_width != regbl_map.cols ) || ( regbl_frame.fr_height != regbl_map.rows ) ) {
+
+            /* display message */
+            # pragma omp critical( regbl_detect_message )
+            std::cerr << "error : inconsistency between map size and storage list size" << std::endl;
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* select black pixels of map */
+        cv::compare( regbl_map, 0, regbl_seed, cv::CMP_EQ );
+
+        /* label connected areas and compute their size */
+        cv::connectedComponentsWithStats( regbl_seed, regbl_label, regbl_stat, regbl_centroid, 4, CV_32S );
+
+        /* release seed image */
+        regbl_seed.release();
+
+        /* compute nearest black pixel of each pixel */
+        regbl_detect_nearest( regbl_map, regbl_nearest, regbl_threads );
+
+        /* release map image */
+        regbl_map.release();
+
+        /* perform detection on the map */
+        regbl_detect( regbl_nearest, regbl_radius, regbl_label, regbl_stat, regbl_store, regbl_select, regbl_index, regbl_result, regbl_overlay != REGBL_OVERLAY_NONE, regbl_mark, regbl_threads );
+
+        /* check overlay mode */
+        if ( regbl_overlay == REGBL_OVERLAY_SPARSE ) {
+
+            /* export detection marks */
+            if ( lc_mark_export( regbl_export_frame + "/" + regbl_frame.fr_name + ".mark", regbl_mark ) == false ) {
+
+                /* display message */
+                # pragma omp critical( regbl_detect_message )
+                std::cerr << "error : unable to export marks for year " << regbl_frame.fr_name << std::endl;
+
+                /* send message */
+                return( false );
+
+            }
+
+        } else if ( regbl_overlay == REGBL_OVERLAY_RASTER ) {
+
+            /* create detection tracking map */
+            regbl_track = cv::Mat::zeros( cv::Size( regbl_frame.fr_width, regbl_frame.fr_height ), CV_8UC4 );
+
+            /* mark detections on tracking map */
+            lc_mark_draw( regbl_track, regbl_mark, 0, 0 );
+
+            /* export map with detections */
+            cv::imwrite( regbl_export_frame + "/" + regbl_frame.fr_name + ".tif", regbl_track );
+
+        }
+
+        /* send message */
+        return( true );
+
+    }
+
+/*
+    source - Exportation methods
+ */
+
+    void regbl_detect_export( lc_store_t & regbl_store, std::vector< uint64_t > const & regbl_select, lc_list_t & regbl_list, std::vector< std::vector< regbl_result_t > > & regbl_result, std::string & regbl_export_detect ) {
+
+        /* output stream */
+        std::ofstream regbl_output;
+
+        /* parsing selected store buildings */
+        for ( size_t regbl_entry = 0; regbl_entry < regbl_select.size(); regbl_entry ++ ) {
+
+            /* create output stream */
+            regbl_output.open( regbl_export_detect + "/" + std::to_string( regbl_store.st_egid[regbl_select[regbl_entry]] ), std::ofstream::app );
+
+            /* check output stream */
+            if ( regbl_output.is_open() == false ) {
+
+                /* display message */
+                std::cerr << "error : unable to write in storage structure : detection file " << std::endl;
+
+                /* send message */
+                exit( 1 );
+
+            }
+
+            /* parsing storage list - year order */
+            for ( unsigned int regbl_parse = 0; regbl_parse < regbl_list.size(); regbl_parse ++ ) {
+
+                /* detection result reference */
+                regbl_result_t const & regbl_record( regbl_result[regbl_parse][regbl_entry] );
+
+                /* export detection result */
+                regbl_output << regbl_list[regbl_parse].fr_name << ( ( regbl_record.rs_found == true ) ? " 1 " : " 0 " ) << regbl_record.rs_x << " " << regbl_record.rs_y << " " << regbl_record.rs_area << std::endl;
+
+            }
+
+            /* delete output stream */
+            regbl_output.close();
+
+        }
+
+    }
+
+    bool regbl_detect_merge( std::string regbl_storage_path, lc_list_t & regbl_list, uint64_t const regbl_count ) {
+
+        /* path composition */
+        std::string regbl_export_detect( regbl_storage_path + "/regbl_output/output_detect" );
+        std::string regbl_export_frame( regbl_storage_path + "/regbl_output/output_frame" );
+
+        /* shard overlays path */
+        std::string regbl_shard;
+
+        /* shard overlays count */
+        uint64_t regbl_present( 0 );
+
+        /* detection marks */
+        std::vector< lc_mark_t > regbl_mark;
+        std::vector< lc_mark_t > regbl_layer;
+
+        /* raster image */
+        cv::Mat regbl_track;
+        cv::Mat regbl_load;
+
+        /* merge detection files */
+        if ( lc_shard_merge( regbl_export_detect, regbl_count ) == false ) {
+
+            /* display message */
+            std::cerr << "error : unable to merge detection shards" << std::endl;
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* parsing shards */
+        for ( uint64_t regbl_index = 0; regbl_index < regbl_count; regbl_index ++ ) {
+
+            /* count shard overlays */
+            regbl_present += std::filesystem::is_directory( lc_shard_path( regbl_export_frame, { regbl_index, regbl_count } ) ) ? 1 : 0;
+
+        }
+
+        /* check overlays - none mode */
+        if ( regbl_present == 0 ) return( true );
 
-                        /* assign a zero size */
-                        regbl_area = 0;
+        /* check overlays consistency */
+        if ( ( regbl_present != regbl_count ) || ( std::filesystem::exists( regbl_export_frame ) == true ) ) {
+
+            /* display message */
+            std::cerr << "error : unable to merge frame shards" << std::endl;
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* create directory */
+        std::filesystem::create_directories( regbl_export_frame );
+
+        /* parsing storage list */
+        for ( lc_frame_t const & regbl_frame : regbl_list ) {
+
+            /* reset marks and overlay */
+            regbl_mark.clear();
+            regbl_track.release();
+
+            /* parsing shards */
+            for ( uint64_t regbl_index = 0; regbl_index < regbl_count; regbl_index ++ ) {
+
+                /* compose shard overlays path */
+                regbl_shard = lc_shard_path( regbl_export_frame, { regbl_index, regbl_count } ) + "/" + regbl_frame.fr_name;
+
+                /* check sparse overlay */
+                if ( std::filesystem::exists( regbl_shard + ".mark" ) == true ) {
+
+                    /* import shard marks */
+                    if ( lc_mark_import( regbl_shard + ".mark", regbl_layer ) == false ) {
+
+                        /* display message */
+                        std::cerr << "error : unable to import marks for year " << regbl_frame.fr_name << std::endl;
+
+                        /* send message */
+                        return( false );
 
                     }
 
-                    /* create output stream */
-                    regbl_output.open( regbl_export_detect + "/" + regbl_egid, std::ofstream::app );
+                    /* append shard marks - shard order */
+                    regbl_mark.insert( regbl_mark.end(), regbl_layer.begin(), regbl_layer.end() );
+
+                }
+
+                /* check raster overlay */
+                if ( std::filesystem::exists( regbl_shard + ".tif" ) == true ) {
 
-                    /* check output stream */
-                    if ( regbl_output.is_open() == false ) {
+                    /* import shard overlay */
+                    regbl_load = cv::imread( regbl_shard + ".tif", cv::IMREAD_UNCHANGED );
+
+                    /* check importation */
+                    if ( ( regbl_load.empty() == true ) || ( regbl_load.type() != CV_8UC4 ) ) {
 
                         /* display message */
-                        std::cerr << "error : unable to write in storage structure : detection file " << std::endl;
+                        std::cerr << "error : unable to import overlay for year " << regbl_frame.fr_name << std::endl;
 
                         /* send message */
-                        exit( 1 );
+                        return( false );
 
                     }
 
-                    /* export detection result */
-                    regbl_output << regbl_year << ( ( regbl_found > 0 ) ? " 1 " : " 0 " ) << regbl_x << " " << regbl_y << " " << regbl_area << std::endl;
+                    /* check merged overlay */
+                    if ( regbl_track.empty() == true ) {
+
+                        /* bootstrap merged overlay */
+                        regbl_track = regbl_load;
+
+                    } else {
+
+                        /* parsing overlay pixels */
+                        for ( int regbl_v = 0; regbl_v < regbl_track.rows; regbl_v ++ ) {
+
+                            /* parsing overlay pixels */
+                            for ( int regbl_u = 0; regbl_u < regbl_track.cols; regbl_u ++ ) {
 
-                    /* delete output stream */
-                    regbl_output.close();
+                                /* copy shard opaque pixels - shard order */
+                                if ( regbl_load.at<cv::Vec4b>( regbl_v, regbl_u )[3] != 0 ) regbl_track.at<cv::Vec4b>( regbl_v, regbl_u ) = regbl_load.at<cv::Vec4b>( regbl_v, regbl_u );
+
+                            }
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+            /* check sparse overlay */
+            if ( regbl_mark.empty() == false ) {
+
+                /* export merged marks */
+                if ( lc_mark_export( regbl_export_frame + "/" + regbl_frame.fr_name + ".mark", regbl_mark ) == false ) {
+
+                    /* display message */
+                    std::cerr << "error : unable to export marks for year " << regbl_frame.fr_name << std::endl;
+
+                    /* send message */
+                    return( false );
 
                 }
 
-                /* delete input stream */
-                regbl_input.close();
+            }
+
+            /* check raster overlay */
+            if ( regbl_track.empty() == false ) {
+
+                /* export merged overlay */
+                cv::imwrite( regbl_export_frame + "/" + regbl_frame.fr_name + ".tif", regbl_track );
 
             }
 
         }
 
+        /* parsing shards */
+        for ( uint64_t regbl_index = 0; regbl_index < regbl_count; regbl_index ++ ) {
+
+            /* remove shard overlays */
+            std::filesystem::remove_all( lc_shard_path( regbl_export_frame, { regbl_index, regbl_count } ) );
+
+        }
+
+        /* send message */
+        return( true );
+
     }
 
 /*
@@ -260,16 +690,64 @@
         /* storage structure path */
         char * regbl_storage_path( lc_read_string( argc, argv, "--storage", "-s" ) );
 
+        /* update flag */
+        bool regbl_update( lc_read_flag( argc, argv, "--update", "-u" ) );
+
+        /* threads count */
+        int regbl_threads( lc_read_unsigned( argc, argv, "--threads", "-t", 1 ) );
+
+        /* detection radius */
+        double regbl_radius( lc_read_double( argc, argv, "--radius", "-r", REGBL_DETECT_RADIUS ) );
+
+        /* overlay mode */
+        char * regbl_overlay_name( lc_read_string( argc, argv, "--overlay", "-o" ) );
+
+        /* overlay mode selection */
+        int regbl_overlay( REGBL_OVERLAY_RASTER );
+
+        /* cube flag */
+        bool regbl_use_cube( lc_read_flag( argc, argv, "--cube", "-k" ) );
+
+        /* shards merge count */
+        uint64_t regbl_merge( lc_read_unsigned( argc, argv, "--merge", "-m", 0 ) );
+
+        /* buildings shard */
+        lc_shard_t regbl_shard;
+
+        /* threads distribution */
+        int regbl_outer( 1 );
+        int regbl_inner( 1 );
+
         /* path composition */
-        std::string regbl_export_egid;
-        std::string regbl_export_position;
         std::string regbl_export_detect;
         std::string regbl_export_frame;
 
-        /* raster image */
-        cv::Mat regbl_map;
-        cv::Mat regbl_track;
-        cv::Mat regbl_mask;
+        /* building store */
+        lc_store_t regbl_store;
+
+        /* years cube - unmapped when maps are imported */
+        lc_cube_t regbl_cube = lc_cube_t();
+
+        /* store changes */
+        std::vector< lc_change_t > regbl_change;
+
+        /* selected buildings */
+        std::vector< uint64_t > regbl_select;
+
+        /* selection flags - store order */
+        std::vector< bool > regbl_flag;
+
+        /* building index */
+        int64_t regbl_found( LC_STORE_NONE );
+
+        /* removal error */
+        std::error_code regbl_error;
+
+        /* years detection results */
+        std::vector< std::vector< regbl_result_t > > regbl_result;
+
+        /* years failure count */
+        int regbl_fail( 0 );
 
         /* storage list */
         lc_list_t regbl_list;
@@ -285,6 +763,59 @@
 
         }
 
+        /* read shard specification */
+        if ( lc_shard_read( argc, argv, "--shard", "-p", regbl_shard ) == false ) {
+
+            /* display message */
+            std::cerr << "error : invalid shard specification" << std::endl;
+
+            /* send message */
+            return( 1 );
+
+        }
+
+        /* check detection radius */
+        if ( ( regbl_radius >= 0. ) == false ) {
+
+            /* display message */
+            std::cerr << "error : invalid detection radius" << std::endl;
+
+            /* send message */
+            return( 1 );
+
+        }
+
+        /* check overlay specification */
+        if ( regbl_overlay_name != NULL ) {
+
+            /* check overlay name */
+            if ( strcmp( regbl_overlay_name, "none" ) == 0 ) {
+
+                /* assign overlay mode */
+                regbl_overlay = REGBL_OVERLAY_NONE;
+
+            } else if ( strcmp( regbl_overlay_name, "sparse" ) == 0 ) {
+
+                /* assign overlay mode */
+                regbl_overlay = REGBL_OVERLAY_SPARSE;
+
+            } else if ( strcmp( regbl_overlay_name, "raster" ) == 0 ) {
+
+                /* assign overlay mode */
+                regbl_overlay = REGBL_OVERLAY_RASTER;
+
+            } else {
+
+                /* display message */
+                std::cerr << "error : unknown overlay mode " << regbl_overlay_name << std::endl;
+
+                /* send message */
+                return( 1 );
+
+            }
+
+        }
+
         /* import storage list */
         regbl_list = lc_list_import( std::string( regbl_storage_path ) + "/regbl_list" );
 
@@ -299,125 +830,251 @@
 
         }
 
-        /* compose path */
-        regbl_export_egid = std::string( regbl_storage_path ) + "/regbl_output/output_egid";
+        /* check merge mode */
+        if ( regbl_merge > 0 ) {
+
+            /* merge shards outputs */
+            return( ( regbl_detect_merge( regbl_storage_path, regbl_list, regbl_merge ) == true ) ? 0 : 1 );
+
+        }
 
-        /* check consistency */
-        if ( std::filesystem::is_directory( regbl_export_egid ) == false ) {
+        /* import building store */
+        if ( lc_store_open( std::string( regbl_storage_path ) + "/regbl_output/output_store", regbl_store ) == false ) {
 
             /* display message */
-            std::cerr << "error : unable to locate egid directory" << std::endl;
+            std::cerr << "error : unable to import building store" << std::endl;
 
             /* send message */
             return( 1 );
 
         }
 
-        /* compose path */
-        regbl_export_position = std::string( regbl_storage_path ) + "/regbl_output/output_position";
-
-        /* check consistency */
-        if ( std::filesystem::is_directory( regbl_export_position ) == false ) {
+        /* check store and list consistency */
+        if ( lc_store_check( regbl_store, regbl_list ) == false ) {
 
             /* display message */
-            std::cerr << "error : unable to locate position directory" << std::endl;
+            std::cerr << "error : inconsistency between building store and storage list" << std::endl;
 
             /* send message */
             return( 1 );
 
         }
 
-        /* compose path */
-        regbl_export_detect = std::string( regbl_storage_path ) + "/regbl_output/output_detect";
+        /* check cube usage */
+        if ( regbl_use_cube == true ) {
 
-        /* check consistency */
-        if ( std::filesystem::is_directory( regbl_export_detect ) == false ) {
+            /* import years cube */
+            if ( lc_cube_open( std::string( regbl_storage_path ) + "/regbl_frame/frame_cube", regbl_cube ) == false ) {
 
-            /* create directory */
-            std::filesystem::create_directories( regbl_export_detect );
+                /* display message */
+                std::cerr << "error : unable to import years cube" << std::endl;
 
-        } else {
+                /* send message */
+                return( 1 );
 
-            /* display message */
-            std::cerr << "error : detect directory already processed" << std::endl;
+            }
 
-            /* send message */
-            return( 1 );
+            /* check cube and list consistency */
+            if ( lc_cube_check( regbl_cube, regbl_list ) == false ) {
+
+                /* display message */
+                std::cerr << "error : inconsistency between years cube and storage list" << std::endl;
+
+                /* send message */
+                return( 1 );
+
+            }
 
         }
 
+        /* allocate selection flags */
+        regbl_flag.resize( regbl_store.st_count, false );
+
+        /* compose path */
+        regbl_export_detect = std::string( regbl_storage_path ) + "/regbl_output/output_detect";
+
         /* compose path */
         regbl_export_frame = std::string( regbl_storage_path ) + "/regbl_output/output_frame";
 
-        /* check consistency */
-        if ( std::filesystem::is_directory( regbl_export_frame ) == false ) {
+        /* check update mode */
+        if ( regbl_update == false ) {
 
-            /* create directory */
-            std::filesystem::create_directories( regbl_export_frame );
+            /* compose shard paths */
+            regbl_export_detect = lc_shard_path( regbl_export_detect, regbl_shard );
+            regbl_export_frame = lc_shard_path( regbl_export_frame, regbl_shard );
 
-        } else {
+            /* check consistency */
+            if ( std::filesystem::is_directory( regbl_export_detect ) == false ) {
 
-            /* display message */
-            std::cerr << "error : frame directory already processed" << std::endl;
+                /* create directory */
+                std::filesystem::create_directories( regbl_export_detect );
 
-            /* send message */
-            return( 1 );
+            } else {
 
-        }
+                /* display message */
+                std::cerr << "error : detect directory already processed" << std::endl;
 
-        /* parsing storage list */
-        for ( unsigned int regbl_parse = 0; regbl_parse < regbl_list.size(); regbl_parse ++ ) {
+                /* send message */
+                return( 1 );
+
+            }
 
-            /* display information */
-            std::cout << "Processing year " << regbl_list[regbl_parse][0] << " ..." << std::endl;
+            /* check overlay mode */
+            if ( regbl_overlay != REGBL_OVERLAY_NONE ) {
 
-            /* import year map */
-            regbl_map = cv::imread( std::string( regbl_storage_path ) + "/regbl_frame/frame/" + regbl_list[regbl_parse][0] + ".tif", cv::IMREAD_GRAYSCALE );
+                /* check consistency */
+                if ( std::filesystem::is_directory( regbl_export_frame ) == false ) {
+
+                    /* create directory */
+                    std::filesystem::create_directories( regbl_export_frame );
+
+                } else {
+
+                    /* display message */
+                    std::cerr << "error : frame directory already processed" << std::endl;
+
+                    /* send message */
+                    return( 1 );
+
+                }
+
+            }
+
+            /* select all buildings */
+            for ( uint64_t regbl_building = 0; regbl_building < regbl_store.st_count; regbl_building ++ ) {
+
+                /* flag building of shard */
+                regbl_flag[regbl_building] = lc_shard_member( regbl_shard, regbl_store.st_egid[regbl_building] );
+
+            }
+
+        } else {
 
-            /* check year map importation */
-            if ( regbl_map.empty() == true ) {
+            /* check consistency */
+            if ( std::filesystem::is_directory( regbl_export_detect ) == false ) {
 
                 /* display message */
-                std::cerr << "error : unable to import map for year " << regbl_list[regbl_parse][0] << std::endl;
+                std::cerr << "error : unable to locate detect directory for update" << std::endl;
 
                 /* send message */
                 return( 1 );
 
-            } else {
+            }
+
+            /* import store changes */
+            if ( lc_change_import( std::string( regbl_storage_path ) + "/regbl_output/output_change", regbl_change ) == false ) {
+
+                /* display message */
+                std::cerr << "error : unable to import changes file" << std::endl;
+
+                /* send message */
+                return( 1 );
+
+            }
+
+            /* parsing changes */
+            for ( lc_change_t const & regbl_entry : regbl_change ) {
+
+                /* check building shard */
+                if ( lc_shard_member( regbl_shard, regbl_entry.ch_egid ) == false ) continue;
+
+                /* remove outdated detection file */
+                std::filesystem::remove( regbl_export_detect + "/" + std::to_string( regbl_entry.ch_egid ), regbl_error );
 
-                /* check map and list consistency */
-                if ( ( std::stoi( regbl_list[regbl_parse][5] ) != regbl_map.cols ) || ( std::stoi( regbl_list[regbl_parse][6] ) != regbl_map.rows ) ) {
+                /* check change type */
+                if ( regbl_entry.ch_type == LC_CHANGE_REMOVE ) continue;
+
+                /* search building in store */
+                if ( ( regbl_found = lc_store_find( regbl_store, regbl_entry.ch_egid ) ) == LC_STORE_NONE ) {
 
                     /* display message */
-                    std::cerr << "error : inconsistency between map size and storage list size" << std::endl;
+                    std::cerr << "error : inconsistency between changes file and building store" << std::endl;
 
                     /* send message */
                     return( 1 );
 
                 }
 
-                /* create connected area mask */
-                regbl_mask = cv::Mat( regbl_map.rows, regbl_map.cols, CV_8UC1, cv::Scalar( 0 ) );
+                /* flag building */
+                regbl_flag[regbl_found] = true;
+
+            }
+
+            /* check overlay mode */
+            if ( regbl_overlay != REGBL_OVERLAY_NONE ) {
+
+                /* display warning */
+                std::cerr << "warning : detection frames are not updated in update mode" << std::endl;
+
+            }
+
+            /* disable overlay */
+            regbl_overlay = REGBL_OVERLAY_NONE;
+
+        }
+
+        /* parsing buildings - hilbert order for map locality */
+        for ( uint64_t regbl_parse = 0; regbl_parse < regbl_store.st_count; regbl_parse ++ ) {
+
+            /* check building flag */
+            if ( regbl_flag[regbl_store.st_order[regbl_parse]] == false ) continue;
+
+            /* push building index */
+            regbl_select.push_back( regbl_store.st_order[regbl_parse] );
+
+        }
+
+        /* check threads count */
+        if ( regbl_threads == 0 ) {
+
+            /* use all available threads */
+            regbl_threads = omp_get_max_threads();
+
+        }
 
-                /* invert map y-axis - fit northing coordinates direction */
-                cv::flip( regbl_map, regbl_map, 0 );
+        /* years threads count - one map per thread in memory */
+        regbl_outer = std::min( regbl_threads, int( regbl_list.size() ) );
 
-                /* create detection tracking map */
-                regbl_track = cv::Mat::zeros( cv::Size( regbl_map.cols, regbl_map.rows ), CV_8UC4 );
+        /* buildings threads count - remaining threads used within years */
+        regbl_inner = std::max( 1, regbl_threads / regbl_outer );
 
-                /* perform detection on the map */
-                regbl_detect( regbl_map, regbl_track, regbl_mask, regbl_export_egid, regbl_export_position, regbl_export_detect, regbl_list[regbl_parse][0] );
+        /* allow nested parallel regions */
+        omp_set_max_active_levels( 2 );
 
-                /* invert tracking map y-axis */
-                cv::flip( regbl_track, regbl_track, 0 );
+        /* allocate years results */
+        regbl_result.resize( regbl_list.size() );
 
-                /* export map with detections */
-                cv::imwrite( std::string( regbl_storage_path ) + "/regbl_output/output_frame/" + regbl_list[regbl_parse][0] + ".tif", regbl_track );
+        /* parsing storage list */
+        # pragma omp parallel for schedule(dynamic) num_threads(regbl_outer) reduction(+:regbl_fail)
+        for ( unsigned int regbl_parse = 0; regbl_parse < regbl_list.size(); regbl_parse ++ ) {
+
+            /* perform detection on the year map */
+            if ( regbl_detect_year( regbl_storage_path, regbl_list[regbl_parse], regbl_parse, regbl_cube, regbl_store, regbl_select, regbl_radius, regbl_overlay, regbl_export_frame, regbl_result[regbl_parse], regbl_inner ) == false ) {
+
+                /* update failure count */
+                regbl_fail ++;
 
             }
 
         }
 
+        /* check years detection */
+        if ( regbl_fail > 0 ) {
+
+            /* send message */
+            return( 1 );
+
+        }
+
+        /* export detection files - year order */
+        regbl_detect_export( regbl_store, regbl_select, regbl_list, regbl_result, regbl_export_detect );
+
+        /* release years cube */
+        lc_cube_close( regbl_cube );
+
+        /* release building store */
+        lc_store_close( regbl_store );
+
         /* send message */
         return( 0 );
 
@@ -54,8 +54,12 @@
 
     # include <iostream>    
     # include <string>
+    # include <cstring>
     # include <fstream>
     # include <filesystem>
+    # include <vector>
+    # include <algorithm>
+    # include <omp.h>
     # include <common-include.hpp>
     # include <opencv2/core/core.hpp>
     # include <opencv2/highgui/highgui.hpp>
@@ -65,6 +69,14 @@
     header - preprocessor definitions
  */
 
+    /* define default detection radius - pixels */
+    # define REGBL_DETECT_RADIUS  ( 3. )
+
+    /* define overlay modes */
+    # define REGBL_OVERLAY_NONE   ( 0 )
+    # define REGBL_OVERLAY_SPARSE ( 1 )
+    # define REGBL_OVERLAY_RASTER ( 2 )
+
 /*
     header - preprocessor macros
  */
@@ -77,71 +89,241 @@
     header - structures
  */
 
+    /*! \struct regbl_result_struct
+     *  \brief Detection result structure
+     *
+     *  This structure holds the result of the detection of a building on the
+     *  map of a year, as written in its detection file.
+     *
+     *  \var regbl_result_struct::rs_found
+     *  Detection flag
+     *  \var regbl_result_struct::rs_x
+     *  Formal detection position, x coordinate in pixels
+     *  \var regbl_result_struct::rs_y
+     *  Formal detection position, y coordinate in pixels
+     *  \var regbl_result_struct::rs_area
+     *  Size, in pixels, of the building connected area
+     */
+
+    typedef struct regbl_result_struct {
+
+        bool    rs_found;
+        int32_t rs_x;
+        int32_t rs_y;
+        int32_t rs_area;
+
+    } regbl_result_t;
+
 /*
     header - function prototypes
  */
 
+    /*! \brief Detection methods
+     *
+     * This function computes, for each pixel of the provided map, the index of
+     * its nearest black pixel, in the exact Euclidean sense. The map is
+     * expected to be pre-processed into a binary image {0,255} on which
+     * buildings are specified in black.
+     *
+     * The computation is made in two separable passes. The first one searches
+     * the nearest black pixel row in each column. The second one computes, on
+     * each row, the lower envelope of the parabolas given by the columns
+     * distances, giving the nearest black pixel in linear time. Both passes
+     * read the images row by row, the first one keeping the last black pixel
+     * row met in each column. They are split by the provided amount of threads
+     * in strips of columns and of rows, respectively.
+     *
+     * The nearest pixel map is an integer image of the map size holding, for
+     * each pixel, the index (row times width plus column) of its nearest black
+     * pixel, or -1 if the map has no black pixel. The nearest pixel of each
+     * position is then obtained in constant time, whatever the detection
+     * radius.
+     *
+     * \param regbl_map     Pre-processed map, single channel binary image
+     * \param regbl_nearest Nearest black pixel map
+     * \param regbl_threads Amount of threads
+     */
+
+    void regbl_detect_nearest( cv::Mat const & regbl_map, cv::Mat & regbl_nearest, int const regbl_threads );
+
     /*! \brief Detection methods
      *
      * This function is use to detect the presence or absence of a building on
-     * the provided map. The map is expected to be pre-processed into a binary
-     * image {0,255} on which buildings are specified in black.
+     * a map, through its nearest black pixel map computed by the function
+     * regbl_detect_nearest().
      *
      * The detection is based on the provided position of the building. As the
      * position come from the RegBL database, it can be de-synchronised with the
-     * building on the map. The function then uses a detection area to not only
-     * relies on a single pixel to determine the presence of a building.
+     * building on the map. The function then considers the building detected
+     * if the nearest black pixel of its position lies within the provided
+     * detection radius, so that it does not only rely on a single pixel.
      *
-     * The detection area is a simple small circle (hard-coded) around the 
-     * position of the building.
+     * As the building is detected by the function, the nearest black pixel is
+     * set in the provided position (provided as pointers). This allows the
+     * parent process to know which pixel lead to the detection.
      *
-     * As the building is detected by the function, the detection pixel is set
-     * in the provided position (provided as pointers). This allows the parent
-     * process to know which pixel lead to the detection.   
+     * \param regbl_nearest Nearest black pixel map
+     * \param regbl_radius  Detection radius, in pixels
+     * \param regbl_x       Position of the building, in pixels, (updated with
+     *                      the detection position)
+     * \param regbl_y       Position of the building, in pixels, (updated with
+     *                      the detection position)
      *
-     * \param regbl_map Pre-processed map, single channel binary image
-     * \param regbl_x   Position of the building, in pixels, (updated with the
-     *                  detection position)
-     * \param regbl_y   Position of the building, in pixels, (updated with the
-     *                  detection position)
+     * \return Returns true if the building is detected, false otherwise
      */
 
-    bool regbl_detect_on_map( cv::Mat & regbl_map, int * const regbl_x, int * const regbl_y );
+    bool regbl_detect_on_map( cv::Mat const & regbl_nearest, double const regbl_radius, int * const regbl_x, int * const regbl_y );
 
     /*! \brief Detection methods
      *
      * This function performs the actual building detection on the current
-     * provided map. It uses the map, expected to be a pre-processed binary
-     * image {0,255}, and the building coordinates to decided whether or not
-     * the buildings are there.
+     * provided map, for a contiguous range of the selected buildings. It uses
+     * the nearest black pixel map of the map and the building coordinates to
+     * decided whether or not the buildings are there.
      *
      * Considering the provided map, corresponding to a specific year (slice of
-     * the 3D raster), the function parses all the building files associate to
-     * the map.
+     * the 3D raster), the function parses the selected buildings of the range,
+     * given by their store index, and reads their position, and the ones of
+     * their entries, for this year.
      *
      * For each building, the function uses the regbl_detect_on_map() function
-     * to determine whether or not the considered building is there. It updates
-     * the tracking overlay to graphically show each detection results (red
-     * cross on missing building, green cross otherwise).
-     *
-     * As the building is detected, the function extracts the connected pixel
-     * area based on the detection position.
-     *
-     * The function then update the detection file of each building by adding a
-     * new line containing the year of the considered map, the detection result
-     * (detected 1, 0 otherwise), the formal detection position, in pixels, and
-     * the size, in pixels, of the building connected area.
-     *
-     * \param regbl_map             Pre-processed map, single channel binary image
-     * \param regbl_track           Tracking overlay image, expected to be an RGBA image
-     * \param regbl_mask            Tracking image for connected area computation
-     * \param regbl_export_egid     EGID files directory
-     * \param regbl_export_position Building position files directory
-     * \param regbl_export_detect   Building detection files directory
-     * \param regbl_year            Year of the provided map (3D raster slice)
+     * to determine whether or not the considered building is there. When the
+     * overlay flag is set, a mark is buffered for each tried position, to be
+     * exported later as the detection overlay.
+     *
+     * As the building is detected, the function reads the size of the
+     * connected pixel area containing the detection position. As the map is
+     * labelled once before the detection, this only requires to look up the
+     * label of the detection pixel in the component area table.
+     *
+     * The function then stores, for each building of the range, the detection
+     * result (detected or not), the formal detection position, in pixels, and
+     * the size, in pixels, of the building connected area in the results array,
+     * at the index of the building in the selection.
+     *
+     * As the map and its components are only read and as the function only
+     * writes its own range of results and its own marks, it can be called on
+     * several ranges at the same time.
+     *
+     * \param regbl_nearest Nearest black pixel map
+     * \param regbl_radius  Detection radius, in pixels
+     * \param regbl_label   Connected components label image of the map
+     * \param regbl_stat    Connected components statistics of the map
+     * \param regbl_store   Building store
+     * \param regbl_select  Indexes of the selected store buildings
+     * \param regbl_index   Index of the map year in the store
+     * \param regbl_begin   First selection index of the range
+     * \param regbl_end     Past-the-end selection index of the range
+     * \param regbl_overlay Overlay flag, enabling the buffering of the marks
+     * \param regbl_result  Detection results, one per selected building
+     * \param regbl_mark    Range detection marks
+     */
+
+    void regbl_detect_chunk( cv::Mat const & regbl_nearest, double const regbl_radius, cv::Mat const & regbl_label, cv::Mat const & regbl_stat, lc_store_t const & regbl_store, std::vector< uint64_t > const & regbl_select, uint32_t const regbl_index, size_t const regbl_begin, size_t const regbl_end, bool const regbl_overlay, std::vector< regbl_result_t > & regbl_result, std::vector< lc_mark_t > & regbl_mark );
+
+    /*! \brief Detection methods
+     *
+     * This function performs the building detection of the selected buildings
+     * on the provided map, given by its nearest black pixel map. The selection
+     * is split in contiguous chunks, four per thread, detected in parallel by
+     * the regbl_detect_chunk() function.
+     *
+     * When the overlay flag is set, the marks buffered by each chunk are then
+     * gathered, chunk after chunk, in the selection order. The marks, and so
+     * the overlay drawn from them, are then the same whatever the amount of
+     * threads.
+     *
+     * The detection files are not written here, allowing the years to be
+     * processed at the same time.
+     *
+     * \param regbl_nearest Nearest black pixel map
+     * \param regbl_radius  Detection radius, in pixels
+     * \param regbl_label   Connected components label image of the map
+     * \param regbl_stat    Connected components statistics of the map
+     * \param regbl_store   Building store
+     * \param regbl_select  Indexes of the selected store buildings
+     * \param regbl_index   Index of the map year in the store
+     * \param regbl_result  Detection results, one per selected building
+     * \param regbl_overlay Overlay flag, enabling the gathering of the marks
+     * \param regbl_mark    Detection marks, in selection order
+     * \param regbl_threads Amount of threads
      */
 
-    void regbl_detect( cv::Mat & regbl_map, cv::Mat & regbl_track, cv::Mat & regbl_mask, std::string & regbl_export_egid, std::string & regbl_export_position, std::string & regbl_export_detect, std::string & regbl_year );
+    void regbl_detect( cv::Mat const & regbl_nearest, double const regbl_radius, cv::Mat const & regbl_label, cv::Mat const & regbl_stat, lc_store_t const & regbl_store, std::vector< uint64_t > const & regbl_select, uint32_t const regbl_index, std::vector< regbl_result_t > & regbl_result, bool const regbl_overlay, std::vector< lc_mark_t > & regbl_mark, int const regbl_threads );
+
+    /*! \brief Detection methods
+     *
+     * This function performs the detection of the selected buildings on the map
+     * of one year. The map is imported, or extracted from the years cube when
+     * it is mapped, and checked against the 3D raster descriptor, its
+     * connected black areas are labelled, its nearest black pixel map is
+     * computed, the map being released afterwards, and the detection is made
+     * by the regbl_detect() function. The detection overlay is then
+     * exported in the frame directory according to the overlay mode : the
+     * marks list in sparse mode (see lc_mark_export()), the full resolution
+     * RGBA image in raster mode, nothing otherwise.
+     *
+     * The function only holds its own images and writes its own results array
+     * and overlay, so that several years can be processed at the same time, the
+     * amount of maps in memory being bounded by the amount of threads. The
+     * messages are displayed in a critical section. The buildings of the year
+     * are themselves detected by the provided amount of threads.
+     *
+     * \param regbl_storage_path Main storage path
+     * \param regbl_frame        3D raster slice descriptor
+     * \param regbl_index        Index of the map year in the store
+     * \param regbl_cube         Years cube, unmapped to import the map
+     * \param regbl_store        Building store
+     * \param regbl_select       Indexes of the selected store buildings
+     * \param regbl_radius       Detection radius, in pixels
+     * \param regbl_overlay      Overlay mode
+     * \param regbl_export_frame Overlays directory
+     * \param regbl_result       Detection results, one per selected building
+     * \param regbl_threads      Amount of threads for the buildings
+     *
+     * \return Returns true on success, false otherwise
+     */
+
+    bool regbl_detect_year( std::string regbl_storage_path, lc_frame_t & regbl_frame, uint32_t const regbl_index, lc_cube_t const & regbl_cube, lc_store_t & regbl_store, std::vector< uint64_t > const & regbl_select, double const regbl_radius, int const regbl_overlay, std::string & regbl_export_frame, std::vector< regbl_result_t > & regbl_result, int const regbl_threads );
+
+    /*! \brief Exportation methods
+     *
+     * This function writes the detection file of each selected building once
+     * all years are processed. Each file is opened once and receives one line
+     * per year, in the order of the 3D raster descriptor, containing the year,
+     * the detection result (detected 1, 0 otherwise), the formal detection
+     * position, in pixels, and the size, in pixels, of the building connected
+     * area. The year order is the one expected by the deduction process.
+     *
+     * \param regbl_store         Building store
+     * \param regbl_select        Indexes of the selected store buildings
+     * \param regbl_list          3D raster descriptor
+     * \param regbl_result        Detection results, one array per year
+     * \param regbl_export_detect Building detection files directory
+     */
+
+    void regbl_detect_export( lc_store_t & regbl_store, std::vector< uint64_t > const & regbl_select, lc_list_t & regbl_list, std::vector< std::vector< regbl_result_t > > & regbl_result, std::string & regbl_export_detect );
+
+    /*! \brief Exportation methods
+     *
+     * This function merges the outputs of the provided amount of shards, each
+     * computed by a run of the detection on a part of the buildings (see the
+     * lc_shard_t structure), into the standard output directories.
+     *
+     * The detection files of the shards are moved in the detection directory
+     * using the lc_shard_merge() function. When the shards exported overlays,
+     * the overlays of each year are merged in the frame directory : the marks
+     * files are concatenated in the shard order and the raster overlays are
+     * superimposed in the shard order. The shard directories are removed.
+     *
+     * \param regbl_storage_path Main storage path
+     * \param regbl_list         3D raster descriptor
+     * \param regbl_count        Amount of shards
+     *
+     * \return Returns true on success, false otherwise
+     */
+
+    bool regbl_detect_merge( std::string regbl_storage_path, lc_list_t & regbl_list, uint64_t const regbl_count );
 
     /*! \brief Main function
      *
@@ -150,30 +332,77 @@
      * detection :
      *
      *      ./regbl_detect --storage/-s path of the main storage directory
+     *                     --update/-u reprocess changed buildings only
+     *                     --threads/-t Amount of threads (0 for all)
+     *                     --radius/-r Detection radius, in pixels
+     *                     --overlay/-o Overlay mode (none, sparse, raster)
+     *                     --shard/-p Buildings shard (i/n)
+     *                     --merge/-m Merge the outputs of the provided amount
+     *                                of shards
+     *                     --cube/-k Extract the maps from the years cube
      *
      * The program starts by reading the 3D raster descriptor file located in
      * the main storage directory. This allows it to get the list of the maps
      * that are available on this geographical area (3D raster slices).
      *
+     * The building store produced by the bootstrap process is then mapped in
+     * memory to access the buildings position for each year.
+     *
      * It then load each pre-processed map out of the expected sub-directory of
      * the main storage directory :
      *
      *     .../regbl_frame/frame/[year].tif
      *
-     * After checking the map and descriptor consistency, the program prepares
-     * the tracking map and the connected region exclusion map adapted to the
-     * loaded map.
+     * After checking the map and descriptor consistency, the program labels
+     * the connected black areas of the map, computing the area of each of them
+     * once for all the buildings of the map. It also computes the nearest
+     * black pixel of each pixel of the map, so that each building position is
+     * checked in constant time against the detection radius, three pixels by
+     * default.
      *
-     * It then performs the detection of the buildings on the current map. For
-     * each map, the tracking map is exported at the end of the detection as an
-     * overlay to allows it to be superimposed with the pre-processed or 
-     * original maps to visually analyse what happened.
+     * The buildings are detected following the Hilbert order of the building
+     * store (see lc_store_t), so that consecutive buildings read neighbouring
+     * parts of the map and of its images.
+     *
+     * The years are independent and are processed at the same time by the
+     * provided amount of threads, each thread holding a single map and its
+     * images. When there are more threads than years, the remaining threads
+     * are used to split the buildings of each year in parallel chunks. The
+     * detection results are kept in memory and the detection files are
+     * written at the end, once per building, in the year order of the 3D
+     * raster descriptor. The files are then the same whatever the amount of
+     * threads.
      *
-     * The overlays are exported in the sub-directory :
+     * It then performs the detection of the buildings on the current map. For
+     * each map, a detection overlay is exported at the end of the detection to
+     * allows it to be superimposed with the pre-processed or original maps to
+     * visually analyse what happened. In raster mode, the default one, the
+     * overlay is a full resolution RGBA image exported as :
      *
      *     .../regbl_output/output_frame/[year].tif
      *
-     * which can then be used as overlays on maps.
+     * In sparse mode, only the detection marks are exported as :
+     *
+     *     .../regbl_output/output_frame/[year].mark
+     *
+     * from which the regbl-overlay tool rasterises any window on demand. No
+     * overlay, and no frame directory, is produced with the none mode.
+     *
+     * With the update flag, the detection directory has to exist and the
+     * changes file written by the bootstrap update is imported. The detection
+     * files of the removed, added and modified buildings are removed and only
+     * the added and modified buildings are detected again. The overlays,
+     * which need all the buildings, are not updated in this mode.
+     *
+     * With the shard specification, only the buildings of the shard i over n
+     * are detected, the shards being given by a stable hash of the EGID (see
+     * the lc_shard_t structure). The shards can then be detected at the same
+     * time by different processes or machines sharing the main storage
+     * directory. Each shard writes its detection files and overlays in its
+     * own directories (output_detect_i_n, output_frame_i_n), merged in the
+     * standard directories by a last run with the merge option. In update
+     * mode, each shard directly updates the detection files of its buildings,
+     * no merge being needed.
      *
      * \param argc Standard parameter
      * \param argv Standard parameter
@@ -0,0 +1,174 @@
+/*
+ *  regbl - overlay
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+    # include "regbl-overlay.hpp"
+
+/*
+    source - Main function
+ */
+
+    int main( int argc, char ** argv ) {
+
+        /* storage structure path */
+        char * regbl_storage_path( lc_read_string( argc, argv, "--storage", "-s" ) );
+
+        /* map year */
+        char * regbl_year( lc_read_string( argc, argv, "--year", "-y" ) );
+
+        /* exportation path */
+        char * regbl_export_path( lc_read_string( argc, argv, "--export", "-e" ) );
+
+        /* window origin */
+        int regbl_column( lc_read_signed( argc, argv, "--column", "-c", 0 ) );
+        int regbl_row   ( lc_read_signed( argc, argv, "--row"   , "-r", 0 ) );
+
+        /* window size */
+        int regbl_width ( lc_read_unsigned( argc, argv, "--width" , "-w", 0 ) );
+        int regbl_height( lc_read_unsigned( argc, argv, "--height", "-t", 0 ) );
+
+        /* storage list */
+        lc_list_t regbl_list;
+
+        /* storage list index */
+        int regbl_index( -1 );
+
+        /* detection marks */
+        std::vector< lc_mark_t > regbl_mark;
+
+        /* overlay image */
+        cv::Mat regbl_overlay;
+
+        /* check path specification */
+        if ( regbl_storage_path == NULL ) {
+
+            /* display message */
+            std::cerr << "error : storage path specification" << std::endl;
+
+            /* send message */
+            return( 1 );
+
+        }
+
+        /* check year specification */
+        if ( regbl_year == NULL ) {
+
+            /* display message */
+            std::cerr << "error : year specification" << std::endl;
+
+            /* send message */
+            return( 1 );
+
+        }
+
+        /* check path specification */
+        if ( regbl_export_path == NULL ) {
+
+            /* display message */
+            std::cerr << "error : exportation path specification" << std::endl;
+
+            /* send message */
+            return( 1 );
+
+        }
+
+        /* import storage list */
+        regbl_list = lc_list_import( std::string( regbl_storage_path ) + "/regbl_list" );
+
+        /* check storage list */
+        if ( regbl_list.size() == 0 ) {
+
+            /* display message */
+            std::cerr << "error : unable to import storage list file" << std::endl;
+
+            /* send message */
+            return( 1 );
+
+        }
+
+        /* parsing storage list */
+        for ( unsigned int regbl_parse = 0; regbl_parse < regbl_list.size(); regbl_parse ++ ) {
+
+            /* search year */
+            if ( regbl_list[regbl_parse].fr_name == regbl_year ) regbl_index = regbl_parse;
+
+        }
+
+        /* check year */
+        if ( regbl_index < 0 ) {
+
+            /* display message */
+            std::cerr << "error : unable to find year " << regbl_year << " in storage list" << std::endl;
+
+            /* send message */
+            return( 1 );
+
+        }
+
+        /* check window width - extend to map edge */
+        if ( regbl_width == 0 ) regbl_width = regbl_list[regbl_index].fr_width - regbl_column;
+
+        /* check window height - extend to map edge */
+        if ( regbl_height == 0 ) regbl_height = regbl_list[regbl_index].fr_height - regbl_row;
+
+        /* check window */
+        if ( ( regbl_width <= 0 ) || ( regbl_height <= 0 ) ) {
+
+            /* display message */
+            std::cerr << "error : empty window" << std::endl;
+
+            /* send message */
+            return( 1 );
+
+        }
+
+        /* import detection marks */
+        if ( lc_mark_import( std::string( regbl_storage_path ) + "/regbl_output/output_frame/" + regbl_year + ".mark", regbl_mark ) == false ) {
+
+            /* display message */
+            std::cerr << "error : unable to import marks for year " << regbl_year << std::endl;
+
+            /* send message */
+            return( 1 );
+
+        }
+
+        /* create overlay image */
+        regbl_overlay = cv::Mat::zeros( cv::Size( regbl_width, regbl_height ), CV_8UC4 );
+
+        /* draw window marks */
+        lc_mark_draw( regbl_overlay, regbl_mark, regbl_column, regbl_row );
+
+        /* export overlay image */
+        if ( cv::imwrite( regbl_export_path, regbl_overlay ) == false ) {
+
+            /* display message */
+            std::cerr << "error : unable to export overlay image" << std::endl;
+
+            /* send message */
+            return( 1 );
+
+        }
+
+        /* send message */
+        return( 0 );
+
+    }
+
@@ -0,0 +1,125 @@
+/*
+ *  regbl - overlay
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Huriel Reichel
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+    /*! \file   regbl-overlay.hpp
+     *  \author Nils Hamel <nils.hamel@alumni.epfl.ch>
+     *  \author Huriel Reichel
+     *
+     *  regbl-overlay
+     */
+
+    /*! \mainpage regbl-poc
+     *
+     *  \section license Copyright and License
+     *
+     *  **regbl** - Nils Hamel, Huriel Reichel <br >
+     *  Copyright (c) 2020 Republic and Canton of Geneva
+     *  
+     *  This program is licensed under the terms of the GNU GPLv3. Documentation
+     *  and illustrations are licensed under the terms of the CC BY 4.0.
+     */
+
+/*
+    header - inclusion guard
+ */
+
+    # ifndef __REGBL_OVERLAY__
+    # define __REGBL_OVERLAY__
+
+/*
+    header - internal includes
+ */
+
+/*
+    header - external includes
+ */
+
+    # include <iostream>    
+    # include <string>
+    # include <vector>
+    # include <common-include.hpp>
+    # include <opencv2/core/core.hpp>
+    # include <opencv2/highgui/highgui.hpp>
+    # include <opencv2/imgproc/imgproc.hpp>
+
+/*
+    header - preprocessor definitions
+ */
+
+/*
+    header - preprocessor macros
+ */
+
+/*
+    header - type definition
+ */
+
+/*
+    header - structures
+ */
+
+/*
+    header - function prototypes
+ */
+
+    /*! \brief Main function
+     *
+     * This program is used to rasterise, on demand, a window of the detection
+     * overlay of a map exported in sparse mode by the detection process :
+     *
+     *     ./regbl_overlay --storage/-s path of the main storage directory
+     *                     --year/-y year of the map
+     *                     --column/-c window origin column, in pixels
+     *                     --row/-r window origin row, in pixels
+     *                     --width/-w window width, in pixels
+     *                     --height/-t window height, in pixels
+     *                     --export/-e exportation image path
+     *
+     * The program reads the 3D raster descriptor to retrieve the size of the
+     * map of the provided year. The window, given by its top-left pixel, is
+     * set by default to the whole map, a null width or height extending it up
+     * to the map edge.
+     *
+     * The detection marks of the year are then imported from :
+     *
+     *     .../regbl_output/output_frame/[year].mark
+     *
+     * and drawn on a transparent RGBA image of the window size, using a red
+     * cross for missing buildings and a green cross otherwise. Rendering the
+     * whole map gives the same image as the raster mode of the detection.
+     *
+     * The image is exported using the provided path, its format being deduced
+     * from its extension.
+     *
+     * \param argc Standard parameter
+     * \param argv Standard parameter
+     *
+     * \return Exit code
+     */
+
+    int main( int argc, char ** argv );
+
+/*
+    header - inclusion guard
+ */
+
+    # endif
+
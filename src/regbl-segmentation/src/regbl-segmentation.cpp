@@ -38,6 +38,16 @@
 
     }
 
+    void regbl_segmentation_io_rate( char const * const regbl_kernel, cv::Mat & regbl_image, std::chrono::steady_clock::time_point const & regbl_start ) {
+
+        /* compute elapsed time */
+        double regbl_elapsed( std::chrono::duration< double >( std::chrono::steady_clock::now() - regbl_start ).count() );
+
+        /* display kernel rate */
+        std::cout << regbl_kernel << " : " << ( ( double ) regbl_image.total() / regbl_elapsed ) * 1e-6 << " Mpixel/s (" << regbl_elapsed * 1e3 << " ms)" << std::endl;
+
+    }
+
 /*
     source - tool methods
  */
@@ -71,68 +81,269 @@
     }
 
 /*
-    source - processing methods
+    source - kernel methods
  */
 
-    void regbl_segmentation_process_extract_black( cv::Mat & regbl_in, cv::Mat & regbl_out, int const regbl_l2dist, int const regbl_graylimit ) {
+    void regbl_segmentation_kernel_black( uchar const * const regbl_in, uchar * const regbl_out, int const regbl_count, int const regbl_l2limit, int const regbl_graylimit ) {
 
-        /* gray proximity flag */
-        bool regbl_gflag( false );
+        /* pixel components */
+        int regbl_b( 0 );
+        int regbl_g( 0 );
+        int regbl_r( 0 );
 
-        /* initialise output matrix */
-        regbl_out = cv::Mat( cv::Size( regbl_in.cols, regbl_in.rows ), CV_8UC1, cv::Scalar(255));
+        /* parsing pixels */
+        for ( int regbl_x = 0; regbl_x < regbl_count; regbl_x ++ ) {
 
-        /* L2-norm */
-        double regbl_l2norm( 0 );
+            /* import components */
+            regbl_b = regbl_in[regbl_x * 3 + 0];
+            regbl_g = regbl_in[regbl_x * 3 + 1];
+            regbl_r = regbl_in[regbl_x * 3 + 2];
 
-        /* parsing pixels */
-        for ( int regbl_x = 0; regbl_x < regbl_in.cols; regbl_x ++ ) {
+            /* default white pixel */
+            regbl_out[regbl_x] = 255;
+
+            /* check L2-norm condition */
+            if ( ( regbl_b * regbl_b + regbl_g * regbl_g + regbl_r * regbl_r ) < regbl_l2limit ) {
 
-            /* parsing pixels */
-            for ( int regbl_y = 0; regbl_y < regbl_in.rows; regbl_y ++ ) {
+                /* components proximity check */
+                if ( ( std::abs( regbl_b - regbl_g ) <= regbl_graylimit ) && ( std::abs( regbl_b - regbl_r ) <= regbl_graylimit ) && ( std::abs( regbl_g - regbl_r ) <= regbl_graylimit ) ) {
 
-                /* compute L2-norm */
-                regbl_l2norm = regbl_in.at<cv::Vec3b>(regbl_y,regbl_x)[0] * regbl_in.at<cv::Vec3b>(regbl_y,regbl_x)[0] +
-                               regbl_in.at<cv::Vec3b>(regbl_y,regbl_x)[1] * regbl_in.at<cv::Vec3b>(regbl_y,regbl_x)[1] +
-                               regbl_in.at<cv::Vec3b>(regbl_y,regbl_x)[2] * regbl_in.at<cv::Vec3b>(regbl_y,regbl_x)[2];
+                    /* assign black pixel */
+                    regbl_out[regbl_x] = 0;
 
-                /* check condition */
-                if ( regbl_l2norm < ( regbl_l2dist * regbl_l2dist ) ) {
+                }
 
-                    /* reset proximity flag */
-                    regbl_gflag = true;
+            }
 
-                    /* parsing components */
-                    for ( int regbl_i = 0; regbl_i < 2; regbl_i ++ ) {
+        }
 
-                        /* parsing components */
-                        for ( int regbl_j = regbl_i + 1; regbl_j < 3; regbl_j ++ ) {
+    }
 
-                            /* component proximity check */
-                            if( std::abs( regbl_in.at<cv::Vec3b>(regbl_y,regbl_x)[regbl_i] - regbl_in.at<cv::Vec3b>(regbl_y,regbl_x)[regbl_j] ) > regbl_graylimit ) {
+    # ifdef REGBL_SEGMENTATION_X86
 
-                                /* update proximity flag */
-                                regbl_gflag = false;
-                            }
+    __attribute__(( target( "ssse3" ) )) void regbl_segmentation_kernel_split( uchar const * const regbl_in, __m128i & regbl_b, __m128i & regbl_g, __m128i & regbl_r ) {
 
-                        }
+        /* import interleaved components - 16 pixels */
+        __m128i regbl_0( _mm_loadu_si128( ( __m128i const * ) ( regbl_in      ) ) );
+        __m128i regbl_1( _mm_loadu_si128( ( __m128i const * ) ( regbl_in + 16 ) ) );
+        __m128i regbl_2( _mm_loadu_si128( ( __m128i const * ) ( regbl_in + 32 ) ) );
 
-                    }
+        /* gather blue components */
+        regbl_b = _mm_or_si128( _mm_or_si128(
+                  _mm_shuffle_epi8( regbl_0, _mm_setr_epi8(  0,  3,  6,  9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 ) ),
+                  _mm_shuffle_epi8( regbl_1, _mm_setr_epi8( -1, -1, -1, -1, -1, -1,  2,  5,  8, 11, 14, -1, -1, -1, -1, -1 ) ) ),
+                  _mm_shuffle_epi8( regbl_2, _mm_setr_epi8( -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  1,  4,  7, 10, 13 ) ) );
 
-                    /* check proximity detection results */
-                    if ( regbl_gflag == true ) {
+        /* gather green components */
+        regbl_g = _mm_or_si128( _mm_or_si128(
+                  _mm_shuffle_epi8( regbl_0, _mm_setr_epi8(  1,  4,  7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 ) ),
+                  _mm_shuffle_epi8( regbl_1, _mm_setr_epi8( -1, -1, -1, -1, -1,  0,  3,  6,  9, 12, 15, -1, -1, -1, -1, -1 ) ) ),
+                  _mm_shuffle_epi8( regbl_2, _mm_setr_epi8( -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  2,  5,  8, 11, 14 ) ) );
 
-                        /* assign black pixel */
-                        regbl_out.at<uchar>(regbl_y,regbl_x) = 0;
+        /* gather red components */
+        regbl_r = _mm_or_si128( _mm_or_si128(
+                  _mm_shuffle_epi8( regbl_0, _mm_setr_epi8(  2,  5,  8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 ) ),
+                  _mm_shuffle_epi8( regbl_1, _mm_setr_epi8( -1, -1, -1, -1, -1,  1,  4,  7, 10, 13, -1, -1, -1, -1, -1, -1 ) ) ),
+                  _mm_shuffle_epi8( regbl_2, _mm_setr_epi8( -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  3,  6,  9, 12, 15 ) ) );
 
-                    }
+    }
 
-                }
+    __attribute__(( target( "ssse3" ) )) void regbl_segmentation_kernel_black_ssse3( uchar const * const regbl_in, uchar * const regbl_out, int const regbl_count, int const regbl_l2limit, int const regbl_graylimit ) {
+
+        /* constant vectors */
+        __m128i const regbl_zero( _mm_setzero_si128() );
+        __m128i const regbl_full( _mm_set1_epi8( -1 ) );
+        __m128i const regbl_norm( _mm_set1_epi32( regbl_l2limit ) );
+        __m128i const regbl_gray( _mm_set1_epi8( ( char ) regbl_graylimit ) );
+
+        /* components vectors */
+        __m128i regbl_b, regbl_g, regbl_r;
+
+        /* widened components vectors */
+        __m128i regbl_bl, regbl_bh, regbl_gl, regbl_gh, regbl_rl, regbl_rh;
+
+        /* norm vectors */
+        __m128i regbl_n0, regbl_n1, regbl_n2, regbl_n3;
+
+        /* proximity vector */
+        __m128i regbl_d0;
+
+        /* parsing index */
+        int regbl_x( 0 );
+
+        /* parsing pixels - 16 pixels by iteration */
+        for ( ; regbl_x + 16 <= regbl_count; regbl_x += 16 ) {
+
+            /* separate components */
+            regbl_segmentation_kernel_split( regbl_in + regbl_x * 3, regbl_b, regbl_g, regbl_r );
+
+            /* widen components to 16-bits */
+            regbl_bl = _mm_unpacklo_epi8( regbl_b, regbl_zero );
+            regbl_bh = _mm_unpackhi_epi8( regbl_b, regbl_zero );
+            regbl_gl = _mm_unpacklo_epi8( regbl_g, regbl_zero );
+            regbl_gh = _mm_unpackhi_epi8( regbl_g, regbl_zero );
+            regbl_rl = _mm_unpacklo_epi8( regbl_r, regbl_zero );
+            regbl_rh = _mm_unpackhi_epi8( regbl_r, regbl_zero );
+
+            /* compute squared L2-norm - b^2 + g^2 and r^2 through multiply-add */
+            regbl_n0 = _mm_unpacklo_epi16( regbl_bl, regbl_gl );
+            regbl_n1 = _mm_unpackhi_epi16( regbl_bl, regbl_gl );
+            regbl_n2 = _mm_unpacklo_epi16( regbl_bh, regbl_gh );
+            regbl_n3 = _mm_unpackhi_epi16( regbl_bh, regbl_gh );
+            regbl_n0 = _mm_add_epi32( _mm_madd_epi16( regbl_n0, regbl_n0 ), _mm_madd_epi16( _mm_unpacklo_epi16( regbl_rl, regbl_zero ), _mm_unpacklo_epi16( regbl_rl, regbl_zero ) ) );
+            regbl_n1 = _mm_add_epi32( _mm_madd_epi16( regbl_n1, regbl_n1 ), _mm_madd_epi16( _mm_unpackhi_epi16( regbl_rl, regbl_zero ), _mm_unpackhi_epi16( regbl_rl, regbl_zero ) ) );
+            regbl_n2 = _mm_add_epi32( _mm_madd_epi16( regbl_n2, regbl_n2 ), _mm_madd_epi16( _mm_unpacklo_epi16( regbl_rh, regbl_zero ), _mm_unpacklo_epi16( regbl_rh, regbl_zero ) ) );
+            regbl_n3 = _mm_add_epi32( _mm_madd_epi16( regbl_n3, regbl_n3 ), _mm_madd_epi16( _mm_unpackhi_epi16( regbl_rh, regbl_zero ), _mm_unpackhi_epi16( regbl_rh, regbl_zero ) ) );
+
+            /* check L2-norm condition and narrow masks to 8-bits */
+            regbl_n0 = _mm_packs_epi16( _mm_packs_epi32( _mm_cmplt_epi32( regbl_n0, regbl_norm ), _mm_cmplt_epi32( regbl_n1, regbl_norm ) ),
+                                        _mm_packs_epi32( _mm_cmplt_epi32( regbl_n2, regbl_norm ), _mm_cmplt_epi32( regbl_n3, regbl_norm ) ) );
+
+            /* compute components largest absolute difference */
+            regbl_d0 = _mm_max_epu8( _mm_max_epu8(
+                       _mm_sub_epi8( _mm_max_epu8( regbl_b, regbl_g ), _mm_min_epu8( regbl_b, regbl_g ) ),
+                       _mm_sub_epi8( _mm_max_epu8( regbl_b, regbl_r ), _mm_min_epu8( regbl_b, regbl_r ) ) ),
+                       _mm_sub_epi8( _mm_max_epu8( regbl_g, regbl_r ), _mm_min_epu8( regbl_g, regbl_r ) ) );
+
+            /* components proximity check - d <= limit when min( d, limit ) = d */
+            regbl_d0 = _mm_cmpeq_epi8( _mm_min_epu8( regbl_d0, regbl_gray ), regbl_d0 );
+
+            /* assign black pixels on both conditions */
+            _mm_storeu_si128( ( __m128i * ) ( regbl_out + regbl_x ), _mm_xor_si128( _mm_and_si128( regbl_n0, regbl_d0 ), regbl_full ) );
+
+        }
+
+        /* process remaining pixels */
+        regbl_segmentation_kernel_black( regbl_in + regbl_x * 3, regbl_out + regbl_x, regbl_count - regbl_x, regbl_l2limit, regbl_graylimit );
+
+    }
+
+    __attribute__(( target( "avx2" ) )) void regbl_segmentation_kernel_black_avx2( uchar const * const regbl_in, uchar * const regbl_out, int const regbl_count, int const regbl_l2limit, int const regbl_graylimit ) {
+
+        /* constant vectors */
+        __m256i const regbl_zero( _mm256_setzero_si256() );
+        __m256i const regbl_full( _mm256_set1_epi8( -1 ) );
+        __m256i const regbl_norm( _mm256_set1_epi32( regbl_l2limit ) );
+        __m256i const regbl_gray( _mm256_set1_epi8( ( char ) regbl_graylimit ) );
+
+        /* half components vectors */
+        __m128i regbl_hb[2], regbl_hg[2], regbl_hr[2];
+
+        /* components vectors */
+        __m256i regbl_b, regbl_g, regbl_r;
+
+        /* widened components vectors */
+        __m256i regbl_bl, regbl_bh, regbl_gl, regbl_gh, regbl_rl, regbl_rh;
+
+        /* norm vectors */
+        __m256i regbl_n0, regbl_n1, regbl_n2, regbl_n3;
+
+        /* proximity vector */
+        __m256i regbl_d0;
+
+        /* parsing index */
+        int regbl_x( 0 );
+
+        /* parsing pixels - 32 pixels by iteration */
+        for ( ; regbl_x + 32 <= regbl_count; regbl_x += 32 ) {
+
+            /* separate components - two halves of 16 pixels */
+            regbl_segmentation_kernel_split( regbl_in + regbl_x * 3     , regbl_hb[0], regbl_hg[0], regbl_hr[0] );
+            regbl_segmentation_kernel_split( regbl_in + regbl_x * 3 + 48, regbl_hb[1], regbl_hg[1], regbl_hr[1] );
+
+            /* compose components vectors - the operations below stay within 128-bits lanes */
+            regbl_b = _mm256_inserti128_si256( _mm256_castsi128_si256( regbl_hb[0] ), regbl_hb[1], 1 );
+            regbl_g = _mm256_inserti128_si256( _mm256_castsi128_si256( regbl_hg[0] ), regbl_hg[1], 1 );
+            regbl_r = _mm256_inserti128_si256( _mm256_castsi128_si256( regbl_hr[0] ), regbl_hr[1], 1 );
+
+            /* widen components to 16-bits */
+            regbl_bl = _mm256_unpacklo_epi8( regbl_b, regbl_zero );
+            regbl_bh = _mm256_unpackhi_epi8( regbl_b, regbl_zero );
+            regbl_gl = _mm256_unpacklo_epi8( regbl_g, regbl_zero );
+            regbl_gh = _mm256_unpackhi_epi8( regbl_g, regbl_zero );
+            regbl_rl = _mm256_unpacklo_epi8( regbl_r, regbl_zero );
+            regbl_rh = _mm256_unpackhi_epi8( regbl_r, regbl_zero );
+
+            /* compute squared L2-norm - b^2 + g^2 and r^2 through multiply-add */
+            regbl_n0 = _mm256_unpacklo_epi16( regbl_bl, regbl_gl );
+            regbl_n1 = _mm256_unpackhi_epi16( regbl_bl, regbl_gl );
+            regbl_n2 = _mm256_unpacklo_epi16( regbl_bh, regbl_gh );
+            regbl_n3 = _mm256_unpackhi_epi16( regbl_bh, regbl_gh );
+            regbl_n0 = _mm256_add_epi32( _mm256_madd_epi16( regbl_n0, regbl_n0 ), _mm256_madd_epi16( _mm256_unpacklo_epi16( regbl_rl, regbl_zero ), _mm256_unpacklo_epi16( regbl_rl, regbl_zero ) ) );
+            regbl_n1 = _mm256_add_epi32( _mm256_madd_epi16( regbl_n1, regbl_n1 ), _mm256_madd_epi16( _mm256_unpackhi_epi16( regbl_rl, regbl_zero ), _mm256_unpackhi_epi16( regbl_rl, regbl_zero ) ) );
+            regbl_n2 = _mm256_add_epi32( _mm256_madd_epi16( regbl_n2, regbl_n2 ), _mm256_madd_epi16( _mm256_unpacklo_epi16( regbl_rh, regbl_zero ), _mm256_unpacklo_epi16( regbl_rh, regbl_zero ) ) );
+            regbl_n3 = _mm256_add_epi32( _mm256_madd_epi16( regbl_n3, regbl_n3 ), _mm256_madd_epi16( _mm256_unpackhi_epi16( regbl_rh, regbl_zero ), _mm256_unpackhi_epi16( regbl_rh, regbl_zero ) ) );
+
+            /* check L2-norm condition and narrow masks to 8-bits */
+            regbl_n0 = _mm256_packs_epi16( _mm256_packs_epi32( _mm256_cmpgt_epi32( regbl_norm, regbl_n0 ), _mm256_cmpgt_epi32( regbl_norm, regbl_n1 ) ),
+                                           _mm256_packs_epi32( _mm256_cmpgt_epi32( regbl_norm, regbl_n2 ), _mm256_cmpgt_epi32( regbl_norm, regbl_n3 ) ) );
+
+            /* compute components largest absolute difference */
+            regbl_d0 = _mm256_max_epu8( _mm256_max_epu8(
+                       _mm256_sub_epi8( _mm256_max_epu8( regbl_b, regbl_g ), _mm256_min_epu8( regbl_b, regbl_g ) ),
+                       _mm256_sub_epi8( _mm256_max_epu8( regbl_b, regbl_r ), _mm256_min_epu8( regbl_b, regbl_r ) ) ),
+                       _mm256_sub_epi8( _mm256_max_epu8( regbl_g, regbl_r ), _mm256_min_epu8( regbl_g, regbl_r ) ) );
+
+            /* components proximity check - d <= limit when min( d, limit ) = d */
+            regbl_d0 = _mm256_cmpeq_epi8( _mm256_min_epu8( regbl_d0, regbl_gray ), regbl_d0 );
+
+            /* assign black pixels on both conditions */
+            _mm256_storeu_si256( ( __m256i * ) ( regbl_out + regbl_x ), _mm256_xor_si256( _mm256_and_si256( regbl_n0, regbl_d0 ), regbl_full ) );
+
+        }
+
+        /* process remaining pixels */
+        regbl_segmentation_kernel_black( regbl_in + regbl_x * 3, regbl_out + regbl_x, regbl_count - regbl_x, regbl_l2limit, regbl_graylimit );
+
+    }
+
+    # endif
+
+/*
+    source - processing methods
+ */
+
+    void regbl_segmentation_process_extract_black( cv::Mat & regbl_in, cv::Mat & regbl_out, int const regbl_l2dist, int const regbl_graylimit, bool const regbl_simd ) {
+
+        /* row kernel */
+        void ( * regbl_kernel )( uchar const * const, uchar * const, int const, int const, int const ) ( regbl_segmentation_kernel_black );
+
+        /* squared L2 threshold */
+        int regbl_l2limit( regbl_l2dist * regbl_l2dist );
+
+        /* initialise output matrix */
+        regbl_out = cv::Mat( cv::Size( regbl_in.cols, regbl_in.rows ), CV_8UC1 );
+
+        # ifdef REGBL_SEGMENTATION_X86
+
+        /* check vector kernels usage - limit has to fit components range */
+        if ( ( regbl_simd == true ) && ( regbl_graylimit >= 0 ) && ( regbl_graylimit <= 255 ) ) {
+
+            /* select kernel based on processor capabilities */
+            if ( __builtin_cpu_supports( "avx2" ) ) {
+
+                /* assign kernel */
+                regbl_kernel = regbl_segmentation_kernel_black_avx2;
+
+            } else if ( __builtin_cpu_supports( "ssse3" ) ) {
+
+                /* assign kernel */
+                regbl_kernel = regbl_segmentation_kernel_black_ssse3;
 
             }
 
         }
 
+        # endif
+
+        /* parsing rows */
+        for ( int regbl_y = 0; regbl_y < regbl_in.rows; regbl_y ++ ) {
+
+            /* process row */
+            regbl_kernel( regbl_in.ptr<uchar>( regbl_y ), regbl_out.ptr<uchar>( regbl_y ), regbl_in.cols, regbl_l2limit, regbl_graylimit );
+
+        }
+
     }
 
     void regbl_segmentation_process_conway_iteration( cv::Mat & regbl_in, cv::Mat & regbl_out, int const regbl_kernel, float const regbl_gamevalue ) {
@@ -150,56 +361,153 @@
         int regbl_count( 0 );
         int regbl_total( 0 );
 
-        /* parsing pixels */
-        for ( int regbl_x = 0; regbl_x < ( regbl_in.cols ); regbl_x ++ ) {
+        /* parsing rows */
+        for ( int regbl_y = 0; regbl_y < regbl_in.rows; regbl_y ++ ) {
+
+            /* compute kernel boundaries */
+            regbl_ly = regbl_y - regbl_kernel;
+            regbl_hy = regbl_y + regbl_kernel + 1;
 
-            /* parsing pixels */
-            for ( int regbl_y = 0; regbl_y < ( regbl_in.rows ); regbl_y ++ ) {
+            /* clamp kernel boundaries */
+            regbl_ly = ( regbl_ly < 0 ) ? 0 : regbl_ly;
+            regbl_hy = ( regbl_hy > regbl_in.rows ) ? regbl_in.rows : regbl_hy;
+
+            /* output row pointer */
+            uchar * regbl_row( regbl_out.ptr<uchar>( regbl_y ) );
+
+            /* parsing columns */
+            for ( int regbl_x = 0; regbl_x < regbl_in.cols; regbl_x ++ ) {
 
                 /* compute kernel boundaries */
                 regbl_lx = regbl_x - regbl_kernel;
-                regbl_ly = regbl_y - regbl_kernel;
                 regbl_hx = regbl_x + regbl_kernel + 1;
-                regbl_hy = regbl_y + regbl_kernel + 1;
 
                 /* clamp kernel boundaries */
                 regbl_lx = ( regbl_lx < 0 ) ? 0 : regbl_lx;
-                regbl_ly = ( regbl_ly < 0 ) ? 0 : regbl_ly;
-
-                /* clamp kernel boundaries */
                 regbl_hx = ( regbl_hx > regbl_in.cols ) ? regbl_in.cols : regbl_hx;
-                regbl_hy = ( regbl_hy > regbl_in.rows ) ? regbl_in.rows : regbl_hy;
 
                 /* reset proportion */
                 regbl_count = 0;
-                regbl_total = 0;
+
+                /* compute region size */
+                regbl_total = ( regbl_hx - regbl_lx ) * ( regbl_hy - regbl_ly );
 
                 /* conway region parser */
-                for ( int u = regbl_lx; u < regbl_hx; u ++ ) {
+                for ( int v = regbl_ly; v < regbl_hy; v ++ ) {
+
+                    /* region row pointer */
+                    uchar const * regbl_cell( regbl_in.ptr<uchar>( v ) );
 
                     /* conway region parser */
-                    for ( int v = regbl_ly; v < regbl_hy; v ++ ) {
+                    for ( int u = regbl_lx; u < regbl_hx; u ++ ) {
 
-                        /* check region cell state */
-                        if ( regbl_in.at<uchar>(v,u) == 0 ) {
+                        /* update counter on region cell state */
+                        regbl_count += ( regbl_cell[u] == 0 );
 
-                            /* update counter */
-                            regbl_count ++;
+                    }
 
-                        }
+                }
 
-                        /* update total */
-                        regbl_total ++;
+                /* cell living condition */
+                if ( ( ( double ) regbl_count / regbl_total ) > regbl_gamevalue ) {
 
-                    }
+                    /* assign binary black */
+                    regbl_row[regbl_x] = 0;
 
                 }
 
+            }
+
+        }
+
+    }
+
+    void regbl_segmentation_process_conway_integral( cv::Mat & regbl_in, cv::Mat & regbl_out, int const regbl_kernel, float const regbl_gamevalue ) {
+
+        /* integral image width */
+        int regbl_width( regbl_in.cols + 1 );
+
+        /* integral image of black cells - modular arithmetic keeps differences exact */
+        std::vector< uint32_t > regbl_sum( ( size_t ) regbl_width * ( regbl_in.rows + 1 ), 0 );
+
+        /* row accumulator */
+        uint32_t regbl_run( 0 );
+
+        /* kernel boundaries */
+        int regbl_lx( 0 );
+        int regbl_ly( 0 );
+        int regbl_hx( 0 );
+        int regbl_hy( 0 );
+
+        /* conway proportion */
+        int regbl_count( 0 );
+        int regbl_total( 0 );
+
+        /* initialise output matrix */
+        regbl_out = cv::Mat( cv::Size( regbl_in.cols, regbl_in.rows ), CV_8UC1, cv::Scalar(255) );
+
+        /* parsing rows */
+        for ( int regbl_y = 0; regbl_y < regbl_in.rows; regbl_y ++ ) {
+
+            /* row pointers */
+            uchar const * regbl_row( regbl_in.ptr<uchar>( regbl_y ) );
+            uint32_t const * regbl_prev( regbl_sum.data() + ( size_t ) regbl_width * ( regbl_y ) );
+            uint32_t * regbl_next( regbl_sum.data() + ( size_t ) regbl_width * ( regbl_y + 1 ) );
+
+            /* reset row accumulator */
+            regbl_run = 0;
+
+            /* parsing columns */
+            for ( int regbl_x = 0; regbl_x < regbl_in.cols; regbl_x ++ ) {
+
+                /* accumulate black cells */
+                regbl_run += ( regbl_row[regbl_x] == 0 );
+
+                /* compose integral value */
+                regbl_next[regbl_x + 1] = regbl_prev[regbl_x + 1] + regbl_run;
+
+            }
+
+        }
+
+        /* parsing rows */
+        for ( int regbl_y = 0; regbl_y < regbl_in.rows; regbl_y ++ ) {
+
+            /* compute kernel boundaries */
+            regbl_ly = regbl_y - regbl_kernel;
+            regbl_hy = regbl_y + regbl_kernel + 1;
+
+            /* clamp kernel boundaries */
+            regbl_ly = ( regbl_ly < 0 ) ? 0 : regbl_ly;
+            regbl_hy = ( regbl_hy > regbl_in.rows ) ? regbl_in.rows : regbl_hy;
+
+            /* integral rows pointers */
+            uint32_t const * regbl_low( regbl_sum.data() + ( size_t ) regbl_width * regbl_ly );
+            uint32_t const * regbl_high( regbl_sum.data() + ( size_t ) regbl_width * regbl_hy );
+
+            /* output row pointer */
+            uchar * regbl_row( regbl_out.ptr<uchar>( regbl_y ) );
+
+            /* parsing columns */
+            for ( int regbl_x = 0; regbl_x < regbl_in.cols; regbl_x ++ ) {
+
+                /* compute kernel boundaries */
+                regbl_lx = regbl_x - regbl_kernel;
+                regbl_hx = regbl_x + regbl_kernel + 1;
+
+                /* clamp kernel boundaries */
+                regbl_lx = ( regbl_lx < 0 ) ? 0 : regbl_lx;
+                regbl_hx = ( regbl_hx > regbl_in.cols ) ? regbl_in.cols : regbl_hx;
+
+                /* compute region count and size */
+                regbl_count = regbl_high[regbl_hx] - regbl_low[regbl_hx] - regbl_high[regbl_lx] + regbl_low[regbl_lx];
+                regbl_total = ( regbl_hx - regbl_lx ) * ( regbl_hy - regbl_ly );
+
                 /* cell living condition */
                 if ( ( ( double ) regbl_count / regbl_total ) > regbl_gamevalue ) {
 
                     /* assign binary black */
-                    regbl_out.at<uchar>(regbl_y,regbl_x) = 0;
+                    regbl_row[regbl_x] = 0;
 
                 }
 
@@ -211,89 +519,295 @@
 
     void regbl_segmentation_process_extract_building( cv::Mat & regbl_clean, cv::Mat & regbl_source, cv::Mat & regbl_output, int const regbl_tolerence ) {
 
-        /* tracker maps */
-        cv::Mat regbl_tracker( cv::Size( regbl_source.cols, regbl_source.rows ), CV_8UC1, cv::Scalar(0) );
+        /* components seed, labels and statistics */
+        cv::Mat regbl_seed, regbl_label, regbl_stat, regbl_centroid;
+
+        /* re-growing area */
+        cv::Mat regbl_grow;
+
+        /* components count */
+        int regbl_count( 0 );
+
+        /* select black pixels of clean image */
+        cv::compare( regbl_clean, 0, regbl_seed, cv::CMP_EQ );
+
+        /* label connected components of clean map */
+        regbl_count = cv::connectedComponentsWithStats( regbl_seed, regbl_label, regbl_stat, regbl_centroid, 4, CV_32S );
+
+        /* components selection table */
+        std::vector< uchar > regbl_keep( regbl_count, 0 );
+
+        /* parsing components - background excluded */
+        for ( int regbl_i = 1; regbl_i < regbl_count; regbl_i ++ ) {
+
+            /* eliminate too small component */
+            regbl_keep[regbl_i] = ( regbl_stat.at<int>( regbl_i, cv::CC_STAT_AREA ) > 1 ) ? 255 : 0;
+
+        }
+
+        /* parsing rows */
+        for ( int regbl_y = 0; regbl_y < regbl_seed.rows; regbl_y ++ ) {
+
+            /* rows pointers */
+            int const * regbl_index( regbl_label.ptr<int>( regbl_y ) );
+            uchar * regbl_cell( regbl_seed.ptr<uchar>( regbl_y ) );
 
-        /* connected component */
-        lc_connect_t regbl_component;
+            /* parsing columns */
+            for ( int regbl_x = 0; regbl_x < regbl_seed.cols; regbl_x ++ ) {
 
-        /* range boundaries */
-        int regbl_lu( 0 );
-        int regbl_hu( 0 );
-        int regbl_lv( 0 );
-        int regbl_hv( 0 );
+                /* keep selected components pixels */
+                regbl_cell[regbl_x] = regbl_keep[regbl_index[regbl_x]];
+
+            }
+
+        }
+
+        /* compute re-growing area around selected components */
+        cv::dilate( regbl_seed, regbl_grow, cv::getStructuringElement( cv::MORPH_RECT, cv::Size( 2 * regbl_tolerence + 1, 2 * regbl_tolerence + 1 ) ) );
 
         /* allocate output image */
-        regbl_output = cv::Mat( cv::Size( regbl_clean.cols, regbl_clean.rows ), CV_8UC1, cv::Scalar(255));
+        regbl_output = cv::Mat( cv::Size( regbl_clean.cols, regbl_clean.rows ), CV_8UC1 );
 
-        /* parsing clean image */
-        for ( int regbl_x = 0; regbl_x < regbl_source.cols; regbl_x ++ ) {
+        /* parsing rows */
+        for ( int regbl_y = 0; regbl_y < regbl_output.rows; regbl_y ++ ) {
 
-            /* parsing clean image */
-            for ( int regbl_y = 0; regbl_y < regbl_source.rows; regbl_y ++ ) {
+            /* rows pointers */
+            uchar const * regbl_cell( regbl_seed.ptr<uchar>( regbl_y ) );
+            uchar const * regbl_area( regbl_grow.ptr<uchar>( regbl_y ) );
+            uchar const * regbl_guide( regbl_source.ptr<uchar>( regbl_y ) );
+            uchar * regbl_build( regbl_output.ptr<uchar>( regbl_y ) );
 
-                /* check tracker state */
-                if ( regbl_tracker.at<uchar>( regbl_y, regbl_x ) == 0 ) {
+            /* parsing columns */
+            for ( int regbl_x = 0; regbl_x < regbl_output.cols; regbl_x ++ ) {
 
-                    /* check pixel state */
-                    if ( regbl_clean.at<uchar>( regbl_y, regbl_x ) == 0 ) {
+                /* validate component pixels and black source pixels of re-growing area */
+                regbl_build[regbl_x] = ( ( regbl_cell[regbl_x] != 0 ) || ( ( regbl_area[regbl_x] != 0 ) && ( regbl_guide[regbl_x] == 0 ) ) ) ? 0 : 255;
 
-                        /* extract connected component of clean map */
-                        regbl_component = lc_connect_get( regbl_clean, regbl_tracker, regbl_x, regbl_y, false );
+            }
 
-                        /* eliminate too small component */
-                        if ( regbl_component.size() > 1 ) {
+        }
 
-                            /* parsing connected component */
-                            for ( unsigned int regbl_i = 0; regbl_i < regbl_component.size(); regbl_i ++ ) {
+    }
 
-                                /* compute boundaries */
-                                regbl_lu = regbl_component[regbl_i][0] - regbl_tolerence;
-                                regbl_hu = regbl_component[regbl_i][0] + regbl_tolerence;
-                                regbl_lv = regbl_component[regbl_i][1] - regbl_tolerence;
-                                regbl_hv = regbl_component[regbl_i][1] + regbl_tolerence;
+    void regbl_segmentation_process_bands( cv::Mat & regbl_source, cv::Mat & regbl_black, cv::Mat & regbl_clean, cv::Mat & regbl_building, int const regbl_engine, bool const regbl_simd, int const regbl_threads ) {
 
-                                /* clamp range */
-                                if ( regbl_lu < 0 ) regbl_lu = 0;
-                                if ( regbl_lv < 0 ) regbl_lv = 0;
+        /* band halo - conway kernel and re-growing tolerence, plus component neighbourhood */
+        int regbl_halo( REGBL_SEGMENTATION_KERNEL + REGBL_SEGMENTATION_TOLERENCE + 1 );
 
-                                /* clamp range */
-                                if ( regbl_hu >= regbl_output.cols ) regbl_hu = regbl_output.cols - 1;
-                                if ( regbl_hv >= regbl_output.rows ) regbl_hv = regbl_output.rows - 1;
+        /* band count */
+        int regbl_count( regbl_threads * REGBL_SEGMENTATION_BANDS );
 
-                                /* parsing region around pixel */
-                                for ( int regbl_u = regbl_lu; regbl_u <= regbl_hu; regbl_u ++ ) {
+        /* band height */
+        int regbl_height( ( regbl_source.rows + regbl_count - 1 ) / regbl_count );
 
-                                    /* parsing region around pixel */
-                                    for ( int regbl_v = regbl_lv; regbl_v <= regbl_hv; regbl_v ++ ) {
+        /* check band height */
+        if ( regbl_height < 1 ) regbl_height = 1;
 
-                                        /* check source image */
-                                        if ( regbl_source.at<uchar>( regbl_v, regbl_u ) == 0 ) {
+        /* update band count */
+        regbl_count = ( regbl_source.rows + regbl_height - 1 ) / regbl_height;
 
-                                            /* validate building pixel */
-                                            regbl_output.at<uchar>( regbl_v, regbl_u ) = 0;
+        /* allocate output images */
+        regbl_black    = cv::Mat( regbl_source.rows, regbl_source.cols, CV_8UC1 );
+        regbl_clean    = cv::Mat( regbl_source.rows, regbl_source.cols, CV_8UC1 );
+        regbl_building = cv::Mat( regbl_source.rows, regbl_source.cols, CV_8UC1 );
 
-                                        }
+        /* parsing bands */
+        # pragma omp parallel for schedule(dynamic) num_threads(regbl_threads)
+        for ( int regbl_band = 0; regbl_band < regbl_count; regbl_band ++ ) {
 
-                                    }
+            /* band core rows */
+            int regbl_ly( regbl_band * regbl_height );
+            int regbl_hy( std::min( regbl_ly + regbl_height, regbl_source.rows ) );
 
-                                }
+            /* band window rows */
+            int regbl_wl( std::max( regbl_ly - regbl_halo, 0 ) );
+            int regbl_wh( std::min( regbl_hy + regbl_halo, regbl_source.rows ) );
 
-                                /* validate central pixel */
-                                regbl_output.at<uchar>( regbl_component[regbl_i][1], regbl_component[regbl_i][0] ) = 0;
+            /* band window */
+            cv::Mat regbl_window( regbl_source.rowRange( regbl_wl, regbl_wh ) );
 
-                            }
+            /* band images */
+            cv::Mat regbl_wblack, regbl_wclean, regbl_wbuilding;
 
-                        }
+            /* black element extraction */
+            regbl_segmentation_process_extract_black( regbl_window, regbl_wblack, REGBL_SEGMENTATION_L2DIST, REGBL_SEGMENTATION_GRAYLIMIT, regbl_simd );
 
-                    }
+            /* check conway engine */
+            if ( regbl_engine == REGBL_SEGMENTATION_NAIVE ) {
 
-                }
+                /* apply conway iteration */
+                regbl_segmentation_process_conway_iteration( regbl_wblack, regbl_wclean, REGBL_SEGMENTATION_KERNEL, REGBL_SEGMENTATION_GAMEVALUE );
+
+            } else {
+
+                /* apply conway iteration */
+                regbl_segmentation_process_conway_integral( regbl_wblack, regbl_wclean, REGBL_SEGMENTATION_KERNEL, REGBL_SEGMENTATION_GAMEVALUE );
+
+            }
+
+            /* extraction of buildings */
+            regbl_segmentation_process_extract_building( regbl_wclean, regbl_wblack, regbl_wbuilding, REGBL_SEGMENTATION_TOLERENCE );
+
+            /* export band core rows */
+            regbl_wblack   .rowRange( regbl_ly - regbl_wl, regbl_hy - regbl_wl ).copyTo( regbl_black   .rowRange( regbl_ly, regbl_hy ) );
+            regbl_wclean   .rowRange( regbl_ly - regbl_wl, regbl_hy - regbl_wl ).copyTo( regbl_clean   .rowRange( regbl_ly, regbl_hy ) );
+            regbl_wbuilding.rowRange( regbl_ly - regbl_wl, regbl_hy - regbl_wl ).copyTo( regbl_building.rowRange( regbl_ly, regbl_hy ) );
+
+        }
+
+    }
+
+/*
+    source - batch methods
+ */
+
+    int regbl_segmentation_batch( std::string const & regbl_input, std::string const & regbl_output, lc_list_t & regbl_list, std::string const & regbl_cube, bool const regbl_invert, bool const regbl_equalize, int const regbl_engine, bool const regbl_simd, int const regbl_threads ) {
+
+        /* amount of years processed simultaneously */
+        int regbl_outer( std::min( regbl_threads, ( int ) regbl_list.size() ) );
+
+        /* amount of threads per year */
+        int regbl_inner( std::max( regbl_threads / std::max( regbl_outer, 1 ), 1 ) );
+
+        /* timings - decoding, processing, encoding */
+        std::vector< std::vector< double > > regbl_timing( regbl_list.size(), std::vector< double >( 3, 0. ) );
+
+        /* processing status */
+        std::vector< int > regbl_status( regbl_list.size(), 0 );
+
+        /* years bit-planes */
+        std::vector< std::vector< uint8_t > > regbl_plane( regbl_list.size() );
+
+        /* exit code */
+        int regbl_return( 0 );
+
+        /* allow bands parallelism within years */
+        omp_set_max_active_levels( 2 );
+
+        /* parsing years */
+        # pragma omp parallel for schedule(dynamic,1) num_threads(regbl_outer)
+        for ( unsigned int regbl_parse = 0; regbl_parse < regbl_list.size(); regbl_parse ++ ) {
+
+            /* processing images */
+            cv::Mat regbl_source, regbl_black, regbl_clean, regbl_binary;
+
+            /* timing clock */
+            std::chrono::steady_clock::time_point regbl_clock( std::chrono::steady_clock::now() );
+
+            /* import source image */
+            regbl_source = cv::imread( regbl_input + "/" + regbl_list[regbl_parse].fr_name + ".tif", cv::IMREAD_COLOR );
+
+            /* check importation */
+            if ( regbl_source.empty() == true ) {
+
+                /* update status */
+                regbl_status[regbl_parse] = 1;
+
+                /* abort year */
+                continue;
+
+            }
+
+            /* decoding timing */
+            regbl_timing[regbl_parse][0] = std::chrono::duration< double >( std::chrono::steady_clock::now() - regbl_clock ).count();
+
+            /* reset clock */
+            regbl_clock = std::chrono::steady_clock::now();
+
+            /* check inversion */
+            if ( regbl_invert == true ) {
+
+                /* invert image */
+                regbl_source = cv::Scalar(255) - regbl_source;
+
+            }
+
+            /* check equalisation */
+            if ( regbl_equalize == true ) {
+
+                /* equalize image */
+                regbl_segmentation_tool_equalize( regbl_source );
+
+            }
+
+            /* process year map */
+            regbl_segmentation_process_bands( regbl_source, regbl_black, regbl_clean, regbl_binary, regbl_engine, regbl_simd, regbl_inner );
+
+            /* processing timing */
+            regbl_timing[regbl_parse][1] = std::chrono::duration< double >( std::chrono::steady_clock::now() - regbl_clock ).count();
+
+            /* reset clock */
+            regbl_clock = std::chrono::steady_clock::now();
+
+            /* export result image */
+            if ( cv::imwrite( regbl_output + "/" + regbl_list[regbl_parse].fr_name + ".tif", regbl_binary ) == false ) {
+
+                /* update status */
+                regbl_status[regbl_parse] = 2;
+
+            }
+
+            /* encoding timing */
+            regbl_timing[regbl_parse][2] = std::chrono::duration< double >( std::chrono::steady_clock::now() - regbl_clock ).count();
+
+            /* check cube exportation */
+            if ( regbl_cube.empty() == false ) {
+
+                /* pack year bit-plane */
+                lc_cube_pack( regbl_binary, regbl_plane[regbl_parse] );
+
+            }
+
+        }
+
+        /* parsing years */
+        for ( unsigned int regbl_parse = 0; regbl_parse < regbl_list.size(); regbl_parse ++ ) {
+
+            /* check status */
+            if ( regbl_status[regbl_parse] == 1 ) {
+
+                /* display message */
+                std::cerr << "error : unable to import map for year " << regbl_list[regbl_parse].fr_name << std::endl;
+
+                /* update exit code */
+                regbl_return = 1;
+
+            } else if ( regbl_status[regbl_parse] == 2 ) {
+
+                /* display message */
+                std::cerr << "error : unable to export map for year " << regbl_list[regbl_parse].fr_name << std::endl;
+
+                /* update exit code */
+                regbl_return = 1;
+
+            } else {
+
+                /* display timings */
+                std::cout << "year " << regbl_list[regbl_parse].fr_name << " : decode " << regbl_timing[regbl_parse][0] << " s, process " << regbl_timing[regbl_parse][1] << " s, encode " << regbl_timing[regbl_parse][2] << " s" << std::endl;
+
+            }
+
+        }
+
+        /* check cube exportation */
+        if ( ( regbl_cube.empty() == false ) && ( regbl_return == 0 ) ) {
+
+            /* export years cube */
+            if ( lc_cube_write( regbl_cube, regbl_list, regbl_plane ) == false ) {
+
+                /* display message */
+                std::cerr << "error : unable to export cube " << regbl_cube << std::endl;
+
+                /* update exit code */
+                regbl_return = 1;
 
             }
 
         }
 
+        /* send message */
+        return( regbl_return );
+
     }
 
 /*
@@ -311,14 +825,50 @@
         /* exportation path */
         char * regbl_state_path( lc_read_string( argc, argv, "--state", "-s" ) );
 
+        /* conway engine */
+        char * regbl_engine_name( lc_read_string( argc, argv, "--engine", "-g" ) );
+
+        /* conway engine selection */
+        int regbl_engine( REGBL_SEGMENTATION_INTEGRAL );
+
+        /* vector kernels flag */
+        bool regbl_simd( lc_read_flag( argc, argv, "--scalar", "-c" ) == false );
+
+        /* benchmark flag */
+        bool regbl_bench( lc_read_flag( argc, argv, "--benchmark", "-b" ) );
+
+        /* benchmark clock */
+        std::chrono::steady_clock::time_point regbl_clock;
+
+        /* batch source directory */
+        char * regbl_batch_path( lc_read_string( argc, argv, "--batch", "-a" ) );
+
+        /* threads count - all available threads by default in batch mode */
+        int regbl_threads( lc_read_unsigned( argc, argv, "--threads", "-t", ( regbl_batch_path != NULL ) ? 0 : 1 ) );
+
+        /* batch exportation directory */
+        char * regbl_out_path( lc_read_string( argc, argv, "--out", "-u" ) );
+
+        /* batch storage list path */
+        char * regbl_list_path( lc_read_string( argc, argv, "--list", "-l" ) );
+
+        /* batch cube exportation path */
+        char * regbl_cube_path( lc_read_string( argc, argv, "--cube", "-k" ) );
+
+        /* storage list */
+        lc_list_t regbl_list;
+
+        /* batch source directory */
+        std::filesystem::path regbl_batch;
+
         /* source image */
-        cv::Mat regbl_source, regbl_binary, regbl_swap;
+        cv::Mat regbl_source, regbl_black, regbl_clean, regbl_binary;
 
         /* state variable */
         int regbl_state( 1 );
 
         /* check consistency */
-        if ( ( regbl_input_path == NULL ) || ( regbl_output_path == NULL ) ) {
+        if ( ( regbl_batch_path == NULL ) && ( ( regbl_input_path == NULL ) || ( regbl_output_path == NULL ) ) ) {
 
             /* display message */
             std::cerr << "error : input/output files specification" << std::endl;
@@ -328,6 +878,92 @@
 
         }
 
+        /* check engine specification */
+        if ( regbl_engine_name != NULL ) {
+
+            /* check engine name */
+            if ( strcmp( regbl_engine_name, "naive" ) == 0 ) {
+
+                /* assign engine */
+                regbl_engine = REGBL_SEGMENTATION_NAIVE;
+
+            } else if ( strcmp( regbl_engine_name, "integral" ) == 0 ) {
+
+                /* assign engine */
+                regbl_engine = REGBL_SEGMENTATION_INTEGRAL;
+
+            } else {
+
+                /* display message */
+                std::cerr << "error : unknown conway engine " << regbl_engine_name << std::endl;
+
+                /* abort */
+                return( 1 );
+
+            }
+
+        }
+
+        /* check threads count */
+        if ( regbl_threads == 0 ) {
+
+            /* use all available threads */
+            regbl_threads = omp_get_max_threads();
+
+        }
+
+        /* check batch mode */
+        if ( regbl_batch_path != NULL ) {
+
+            /* check consistency */
+            if ( regbl_out_path == NULL ) {
+
+                /* display message */
+                std::cerr << "error : batch exportation directory specification" << std::endl;
+
+                /* abort */
+                return( 1 );
+
+            }
+
+            /* check list specification */
+            if ( regbl_list_path == NULL ) {
+
+                /* compose source directory path */
+                regbl_batch = std::filesystem::absolute( regbl_batch_path );
+
+                /* remove trailing separator */
+                if ( regbl_batch.has_filename() == false ) regbl_batch = regbl_batch.parent_path();
+
+                /* import storage list - located in the main storage directory */
+                regbl_list = lc_list_import( ( regbl_batch.parent_path().parent_path() / "regbl_list" ).string() );
+
+            } else {
+
+                /* import storage list */
+                regbl_list = lc_list_import( std::string( regbl_list_path ) );
+
+            }
+
+            /* check storage list */
+            if ( regbl_list.size() == 0 ) {
+
+                /* display message */
+                std::cerr << "error : unable to import storage list file" << std::endl;
+
+                /* abort */
+                return( 1 );
+
+            }
+
+            /* create exportation directory */
+            std::filesystem::create_directories( regbl_out_path );
+
+            /* process all years */
+            return( regbl_segmentation_batch( std::string( regbl_batch_path ), std::string( regbl_out_path ), regbl_list, std::string( regbl_cube_path == NULL ? "" : regbl_cube_path ), lc_read_flag( argc, argv, "--invert", "-v" ), lc_read_flag( argc, argv, "--equalize", "-e" ), regbl_engine, regbl_simd, regbl_threads ) );
+
+        }
+
         /* import source image */
         regbl_source = cv::imread( regbl_input_path, cv::IMREAD_COLOR );
 
@@ -371,39 +1007,65 @@
 
         }
 
-        /* black element extraction - @devs : the last parameters (64, 16) are magical parameters */
-        regbl_segmentation_process_extract_black( regbl_source, regbl_binary, 64, 16 );
+        /* check processing mode */
+        if ( regbl_threads > 1 ) {
 
-        /* check state specification */
-        if ( regbl_state_path != NULL ) {
+            /* start benchmark clock */
+            regbl_clock = std::chrono::steady_clock::now();
 
-            /* export state */
-            regbl_state = regbl_segmentation_io_state( regbl_binary, regbl_state, std::string( regbl_state_path ) );
+            /* process bands in parallel */
+            regbl_segmentation_process_bands( regbl_source, regbl_black, regbl_clean, regbl_binary, regbl_engine, regbl_simd, regbl_threads );
 
-        }
+            /* check benchmark */
+            if ( regbl_bench == true ) regbl_segmentation_io_rate( "process_bands", regbl_binary, regbl_clock );
 
-        /* push black extraction as source */
-        regbl_source = regbl_binary;
+        } else {
 
-        /* apply conway iteration - @devs : the two parameters (2, 8/9) are magical parameters */
-        regbl_segmentation_process_conway_iteration( regbl_binary, regbl_swap, 2, 8./9. );
+            /* start benchmark clock */
+            regbl_clock = std::chrono::steady_clock::now();
 
-        /* check state specification */
-        if ( regbl_state_path != NULL ) {
+            /* black element extraction */
+            regbl_segmentation_process_extract_black( regbl_source, regbl_black, REGBL_SEGMENTATION_L2DIST, REGBL_SEGMENTATION_GRAYLIMIT, regbl_simd );
 
-            /* export state */
-            regbl_state = regbl_segmentation_io_state( regbl_swap, regbl_state, std::string( regbl_state_path ) );
+            /* check benchmark */
+            if ( regbl_bench == true ) regbl_segmentation_io_rate( "extract_black", regbl_source, regbl_clock );
 
-        }
+            /* start benchmark clock */
+            regbl_clock = std::chrono::steady_clock::now();
+
+            /* check conway engine */
+            if ( regbl_engine == REGBL_SEGMENTATION_NAIVE ) {
 
+                /* apply conway iteration */
+                regbl_segmentation_process_conway_iteration( regbl_black, regbl_clean, REGBL_SEGMENTATION_KERNEL, REGBL_SEGMENTATION_GAMEVALUE );
 
-        /* extraction of buildings - @devs : the last parameter (2) is a magical parameter, which should be equal or similar to the one above */
-        regbl_segmentation_process_extract_building( regbl_swap, regbl_source, regbl_binary, 2 );
+            } else {
+
+                /* apply conway iteration */
+                regbl_segmentation_process_conway_integral( regbl_black, regbl_clean, REGBL_SEGMENTATION_KERNEL, REGBL_SEGMENTATION_GAMEVALUE );
+
+            }
+
+            /* check benchmark */
+            if ( regbl_bench == true ) regbl_segmentation_io_rate( "conway_iteration", regbl_black, regbl_clock );
+
+            /* start benchmark clock */
+            regbl_clock = std::chrono::steady_clock::now();
+
+            /* extraction of buildings */
+            regbl_segmentation_process_extract_building( regbl_clean, regbl_black, regbl_binary, REGBL_SEGMENTATION_TOLERENCE );
+
+            /* check benchmark */
+            if ( regbl_bench == true ) regbl_segmentation_io_rate( "extract_building", regbl_binary, regbl_clock );
+
+        }
 
         /* check state specification */
         if ( regbl_state_path != NULL ) {
 
-            /* export state */
+            /* export states */
+            regbl_state = regbl_segmentation_io_state( regbl_black , regbl_state, std::string( regbl_state_path ) );
+            regbl_state = regbl_segmentation_io_state( regbl_clean , regbl_state, std::string( regbl_state_path ) );
             regbl_state = regbl_segmentation_io_state( regbl_binary, regbl_state, std::string( regbl_state_path ) );
 
         }
@@ -415,4 +1077,3 @@
         return( 0 );
 
     }
-
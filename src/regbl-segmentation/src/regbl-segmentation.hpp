@@ -54,6 +54,16 @@
 
     # include <iostream>    
     # include <string>
+    # include <vector>
+    # include <cstring>
+    # include <cstdint>
+    # include <chrono>
+    # include <algorithm>
+    # include <filesystem>
+    # include <omp.h>
+    # if defined( __x86_64__ ) || defined( __i386__ )
+    # include <immintrin.h>
+    # endif
     # include <common-include.hpp>
     # include <opencv2/core/core.hpp>
     # include <opencv2/highgui/highgui.hpp>
@@ -63,6 +73,29 @@
     header - preprocessor definitions
  */
 
+    /* define vector kernels availability */
+    # if defined( __x86_64__ ) || defined( __i386__ )
+    # define REGBL_SEGMENTATION_X86
+    # endif
+
+    /* define black extraction thresholds - @devs : magical parameters */
+    # define REGBL_SEGMENTATION_L2DIST    ( 64 )
+    # define REGBL_SEGMENTATION_GRAYLIMIT ( 16 )
+
+    /* define conway kernel and rule - @devs : magical parameters */
+    # define REGBL_SEGMENTATION_KERNEL    ( 2 )
+    # define REGBL_SEGMENTATION_GAMEVALUE ( 8. / 9. )
+
+    /* define re-growing tolerence - @devs : magical parameter, which should be equal or similar to the conway kernel */
+    # define REGBL_SEGMENTATION_TOLERENCE ( 2 )
+
+    /* define amount of bands per thread */
+    # define REGBL_SEGMENTATION_BANDS     ( 4 )
+
+    /* define conway engines */
+    # define REGBL_SEGMENTATION_NAIVE    ( 0 )
+    # define REGBL_SEGMENTATION_INTEGRAL ( 1 )
+
 /*
     header - preprocessor macros
  */
@@ -96,6 +129,92 @@
 
     int regbl_segmentation_io_state( cv::Mat & regbl_image, int regbl_state, std::string regbl_path );
 
+    /*! \brief i/o methods
+     *
+     * This function is used to display the processing rate of a kernel. The
+     * elapsed time since the provided starting time is computed and used with
+     * the amount of pixels of the provided image to display the rate, in mega
+     * pixels per second, on the standard output.
+     *
+     * \param regbl_kernel Name of the benchmarked kernel
+     * \param regbl_image  Image processed by the kernel
+     * \param regbl_start  Starting time of the kernel
+     */
+
+    void regbl_segmentation_io_rate( char const * const regbl_kernel, cv::Mat & regbl_image, std::chrono::steady_clock::time_point const & regbl_start );
+
+    /*! \brief kernel methods
+     *
+     * This function implements the black pixel selection of the function
+     * regbl_segmentation_process_extract_black() on a single row of pixels.
+     * The provided row is expected to be a BGR interleaved array of bytes. The
+     * output row receives zero for selected pixels and 255 otherwise.
+     *
+     * This is the reference scalar kernel, used when no vector kernel can be
+     * considered and to process the remaining pixels of the vector kernels.
+     *
+     * \param regbl_in        Input row, BGR interleaved
+     * \param regbl_out       Output row, single channel
+     * \param regbl_count     Amount of pixels in the row
+     * \param regbl_l2limit   Squared L2 criterion threshold
+     * \param regbl_graylimit Component similarity threshold
+     */
+
+    void regbl_segmentation_kernel_black( uchar const * const regbl_in, uchar * const regbl_out, int const regbl_count, int const regbl_l2limit, int const regbl_graylimit );
+
+    # ifdef REGBL_SEGMENTATION_X86
+
+    /*! \brief kernel methods
+     *
+     * This function loads 16 BGR interleaved pixels and separates their blue,
+     * green and red components in three vectors using byte shuffles.
+     *
+     * \param regbl_in Input pixels, BGR interleaved (48 bytes)
+     * \param regbl_b  Blue components vector
+     * \param regbl_g  Green components vector
+     * \param regbl_r  Red components vector
+     */
+
+    __attribute__(( target( "ssse3" ) )) void regbl_segmentation_kernel_split( uchar const * const regbl_in, __m128i & regbl_b, __m128i & regbl_g, __m128i & regbl_r );
+
+    /*! \brief kernel methods
+     *
+     * SSSE3 version of the regbl_segmentation_kernel_black() function. The
+     * pixels are processed by groups of 16. The squared L2 norm is computed
+     * on 32-bits integers using multiply-add operations while the components
+     * proximity is checked on bytes. Both masks are combined to produce the
+     * output bytes directly.
+     *
+     * The component similarity threshold is expected to be in [0,255].
+     *
+     * \param regbl_in        Input row, BGR interleaved
+     * \param regbl_out       Output row, single channel
+     * \param regbl_count     Amount of pixels in the row
+     * \param regbl_l2limit   Squared L2 criterion threshold
+     * \param regbl_graylimit Component similarity threshold
+     */
+
+    __attribute__(( target( "ssse3" ) )) void regbl_segmentation_kernel_black_ssse3( uchar const * const regbl_in, uchar * const regbl_out, int const regbl_count, int const regbl_l2limit, int const regbl_graylimit );
+
+    /*! \brief kernel methods
+     *
+     * AVX2 version of the regbl_segmentation_kernel_black() function. The
+     * pixels are processed by groups of 32, using the same operations as the
+     * SSSE3 version on 256-bits vectors.
+     *
+     * The component similarity threshold is expected to be in [0,255].
+     *
+     * \param regbl_in        Input row, BGR interleaved
+     * \param regbl_out       Output row, single channel
+     * \param regbl_count     Amount of pixels in the row
+     * \param regbl_l2limit   Squared L2 criterion threshold
+     * \param regbl_graylimit Component similarity threshold
+     */
+
+    __attribute__(( target( "avx2" ) )) void regbl_segmentation_kernel_black_avx2( uchar const * const regbl_in, uchar * const regbl_out, int const regbl_count, int const regbl_l2limit, int const regbl_graylimit );
+
+    # endif
+
     /*! \brief processing methods
      *
      * This function performs a standard equalization of the image. The process
@@ -137,13 +256,19 @@
      * If the two previous criterion are verified, the pixel of the input image
      * is considered as black and the output image is updated accordingly.
      *
+     * Each row of the image is processed by a kernel selected at runtime : the
+     * AVX2 or SSSE3 one, depending on the processor capabilities, or the scalar
+     * one when the vector kernels are disabled or not available. All kernels
+     * give the same result.
+     *
      * \param regbl_in        Input RGB image
      * \param regbl_out       Output binary image (single channel)
      * \param regbl_l2dist    L2 criterion threshold
      * \param regbl_graylimit Component similarity threshold
+     * \param regbl_simd      Vector kernels usage flag
      */
 
-    void regbl_segmentation_process_extract_black( cv::Mat & regbl_in, cv::Mat & regbl_out, int const regbl_l2dist, int const regbl_graylimit );
+    void regbl_segmentation_process_extract_black( cv::Mat & regbl_in, cv::Mat & regbl_out, int const regbl_l2dist, int const regbl_graylimit, bool const regbl_simd );
 
     /*! \brief processing methods
      *
@@ -174,6 +299,30 @@
 
     void regbl_segmentation_process_conway_iteration( cv::Mat & regbl_in, cv::Mat & regbl_out, int const regbl_kernel, float const regbl_gamevalue );
 
+    /*! \brief processing methods
+     *
+     * This function computes exactly the same result as the function
+     * regbl_segmentation_process_conway_iteration() but counts the black cells
+     * of each area using an integral image (summed-area table) of the input.
+     *
+     * The integral image is computed in a single pass, each cell holding the
+     * amount of black pixels in the rectangle spanned by the origin and the
+     * cell. The count of any area is then obtained using four accesses to the
+     * integral image, making the cost of each pixel independent of the value
+     * of regbl_kernel.
+     *
+     * The integral image is stored using unsigned 32-bits integers. As only
+     * differences of its values are used, the modular arithmetic keeps the
+     * counts exact even when the image total overflows.
+     *
+     * \param regbl_in        Input image, single channel binary image
+     * \param regbl_out       Output image, single channel binary image
+     * \param regbl_kernel    Half size, in pixels, of the searching area
+     * \param regbl_gamevalue Conway variation game rule value (threshold)
+     */
+
+    void regbl_segmentation_process_conway_integral( cv::Mat & regbl_in, cv::Mat & regbl_out, int const regbl_kernel, float const regbl_gamevalue );
+
     /*! \brief processing methods
      *
      * This function implements a building extraction procedure out of the
@@ -205,6 +354,13 @@
      * can not grows structure beyond the value provided by the regbl_tolerence
      * value.
      *
+     * The connected components are labelled in a single pass over the image,
+     * components of a single pixel being dropped. The area around the kept
+     * components is then obtained through a dilation of their pixels using a
+     * square structuring element, which is intersected with the black pixels
+     * of the source map. The process then runs in linear time with respect to
+     * the image size, whatever the density of the components.
+     *
      * \param regbl_clean     Cleaned version of the source map
      * \param regbl_source    Binary (black and white) version of the source map
      * \param regbl_output    Output map
@@ -213,6 +369,69 @@
 
     void regbl_segmentation_process_extract_building( cv::Mat & regbl_clean, cv::Mat & regbl_source, cv::Mat & regbl_output, int const regbl_tolerence );
 
+    /*! \brief processing methods
+     *
+     * This function applies the black extraction, the Conway operator and the
+     * building extraction on the provided source image using several threads.
+     * The image is split into bands of rows that are processed independently
+     * and in parallel.
+     *
+     * Each band is processed on a window that extends its rows by a halo on
+     * both sides. The halo is made of the Conway kernel size, the re-growing
+     * tolerence and one more row, needed to decide if a pixel belongs to a
+     * connected component of more than one pixel. This guarantees that the
+     * rows of each band are computed exactly as on the full image, leading to
+     * the same result as the serial processing.
+     *
+     * The three steps results are returned through the provided images, which
+     * are allocated by the function.
+     *
+     * \param regbl_source   Source image, RGB
+     * \param regbl_black    Black extraction result
+     * \param regbl_clean    Conway operator result
+     * \param regbl_building Building extraction result
+     * \param regbl_engine   Conway engine
+     * \param regbl_simd     Vector kernels usage flag
+     * \param regbl_threads  Amount of threads
+     */
+
+    void regbl_segmentation_process_bands( cv::Mat & regbl_source, cv::Mat & regbl_black, cv::Mat & regbl_clean, cv::Mat & regbl_building, int const regbl_engine, bool const regbl_simd, int const regbl_threads );
+
+    /*! \brief batch methods
+     *
+     * This function applies the segmentation on all the maps listed in the
+     * provided 3D raster descriptor. The source maps are imported from the
+     * source directory and the results are exported in the exportation one,
+     * both named after their year.
+     *
+     * The years are distributed over the available threads, each thread
+     * importing, processing and exporting its own year. The decoding of a map
+     * then overlaps with the processing and encoding of the other ones. When
+     * more threads than years are available, the remaining threads are used
+     * to process the bands of each map.
+     *
+     * The decoding, processing and encoding durations of each year are then
+     * displayed on the standard output.
+     *
+     * When a cube path is provided, the black pixels of each segmented map are
+     * also packed in a bit-plane and, all years being processed successfully,
+     * the bit-planes are gathered in a cube file (lc_cube_write()).
+     *
+     * \param regbl_input    Source maps directory
+     * \param regbl_output   Exportation directory
+     * \param regbl_list     3D raster descriptor
+     * \param regbl_cube     Cube exportation path, empty for none
+     * \param regbl_invert   Image inversion flag
+     * \param regbl_equalize Image equalization flag
+     * \param regbl_engine   Conway engine
+     * \param regbl_simd     Vector kernels usage flag
+     * \param regbl_threads  Amount of threads
+     *
+     * \return Returns zero on success, one otherwise
+     */
+
+    int regbl_segmentation_batch( std::string const & regbl_input, std::string const & regbl_output, lc_list_t & regbl_list, std::string const & regbl_cube, bool const regbl_invert, bool const regbl_equalize, int const regbl_engine, bool const regbl_simd, int const regbl_threads );
+
     /*! \brief Main function
      *
      * This program allows to process a digitized map (developed and tested on
@@ -224,6 +443,16 @@
      *                          --state/-s Processing step exportation
      *                          --invert/-v Image inversion flag
      *                          --equalize/-e Image equalization flag
+     *                          --engine/-g Conway engine (naive, integral)
+     *                          --benchmark/-b Kernels rate display flag
+     *                          --scalar/-c Vector kernels deactivation flag
+     *                          --threads/-t Amount of threads (0 for all,
+     *                                       default 1, 0 in batch mode)
+     *                          --batch/-a Source maps directory (batch mode)
+     *                          --out/-u Exportation directory (batch mode)
+     *                          --list/-l 3D raster descriptor (batch mode)
+     *                          --cube/-k Years cube exportation path (batch
+     *                                    mode)
      *
      * The source image, expected to be RGB is loaded in the first place and
      * inverted if the invert flag is set. The function also checks if the
@@ -236,7 +465,10 @@
      * As building on maps are most of the time glued with other elements of the
      * map, such as roads, train tracks and other buildings, a Conway based 
      * morphological operator is used to shrink the black structure, forcing
-     * their separation.
+     * their separation. The operator can be computed using the naive engine,
+     * counting each area pixel by pixel, or the integral engine, which uses a
+     * summed-area table. Both engines give the same result, the integral one
+     * being the default.
      *
      * After this step, the building footprints are smaller than the original
      * buildings on the source map. A re-growing process is finally applied to
@@ -250,6 +482,20 @@
      * all the steps are exported as successive image. This allows to analyze in
      * detail the process to see what has gone wrong when needed.
      *
+     * When more than one thread is requested, the three processing steps are
+     * applied in parallel on bands of the image, giving the same result as the
+     * serial processing.
+     *
+     * In batch mode, all the maps listed in the 3D raster descriptor are read
+     * from the source directory and processed using a pool of threads, all the
+     * available threads being used unless specified otherwise. The results
+     * are exported in the exportation directory, named after their year. The
+     * descriptor is searched in the main storage directory, two levels above
+     * the source directory, unless it is explicitly provided.
+     *
+     * When the benchmark flag is set, the processing rate of each kernel is
+     * displayed on the standard output in mega pixels per second.
+     *
      * \param argc Standard parameter
      * \param argv Standard parameter
      *
@@ -44,7 +44,7 @@
 
     }
 
-    void regbl_tracker_building( cv::Mat & regbl_crop, int const regbl_cnx, int const regbl_cny, std::ifstream & regbl_stream ) {
+    void regbl_tracker_building( cv::Mat & regbl_crop, int const regbl_cnx, int const regbl_cny, int32_t const * const regbl_point, uint64_t const regbl_count ) {
 
         /* importation token */
         double regbl_cx( 0. );
@@ -55,15 +55,16 @@
         /* display central position */
         cv::circle( regbl_crop, cv::Point( regbl_cnx, regbl_cny ), 1, cv::Scalar( 224, 16, 224 ), cv::FILLED );
 
-        /* clear stream */
-        regbl_stream.clear();
-        regbl_stream.seekg(0);
-
         /* import central position */
-        regbl_stream >> regbl_cx >> regbl_cy;
+        regbl_cx = regbl_point[0];
+        regbl_cy = regbl_point[1];
 
         /* parsing remaining position */
-        while ( regbl_stream >> regbl_ux >> regbl_uy ) {
+        for ( uint64_t regbl_parse = 1; regbl_parse < regbl_count; regbl_parse ++ ) {
+
+            /* import entry position */
+            regbl_ux = regbl_point[regbl_parse * 2 + 0];
+            regbl_uy = regbl_point[regbl_parse * 2 + 1];
 
             /* shift to center */
             regbl_ux -= regbl_cx;
@@ -71,7 +72,7 @@
 
             /* round and compute position */
             regbl_ux = regbl_cnx + std::round( regbl_ux );
-            regbl_uy = regbl_cny - std::round( regbl_uy );
+            regbl_uy = regbl_cny + std::round( regbl_uy );
 
             /* display entires position */
             cv::circle( regbl_crop, cv::Point( regbl_ux, regbl_uy ), 1, cv::Scalar( 224, 16, 224 ), cv::FILLED );
@@ -203,33 +204,23 @@
     }
 
 /*
-    source - Main function
+    source - Exportation methods
  */
 
-    int main( int argc, char ** argv ) {
-
-        /* storage structure path */
-        char * regbl_storage_path( lc_read_string( argc, argv, "--storage", "-s" ) );
-
-        /* building identifier (EGID) */
-        char * regbl_building_id( lc_read_string( argc, argv, "--egid", "-g" ) );
+    bool regbl_tracker_export( std::string regbl_storage_path, lc_list_t & regbl_list, lc_store_t & regbl_store, int64_t const regbl_building, std::vector< cv::Mat > const & regbl_original, std::vector< cv::Mat > const & regbl_segmented, std::string regbl_output_path ) {
 
-        /* exportation directory */
-        char * regbl_output_path( lc_read_string( argc, argv, "--export", "-e" ) );
+        /* building egid */
+        std::string regbl_egid( std::to_string( regbl_store.st_egid[regbl_building] ) );
 
         /* path composition */
-        std::string regbl_export_position;
-        std::string regbl_export_detect;
-        std::string regbl_export_reference;
-        std::string regbl_export_surface;
-        std::string regbl_export_deduce;
+        std::string regbl_export_detect( regbl_storage_path + "/regbl_output/output_detect" );
+        std::string regbl_export_deduce( regbl_storage_path + "/regbl_output/output_deduce" );
 
         /* importation token */
         std::string regbl_year;
         std::string regbl_ryear;
         std::string regbl_udeduce;
         std::string regbl_ldeduce;
-        std::string regbl_void;
 
         /* importation token */
         int regbl_area( -1 );
@@ -269,420 +260,517 @@
         cv::Mat regbl_adet;
         cv::Mat regbl_aref;
 
-        /* storage list */
-        lc_list_t regbl_list;
+        /* building points */
+        int32_t const * regbl_point( NULL );
 
         /* building database stream */
         std::ifstream regbl_input;
-        std::ifstream regbl_position;
-        std::ifstream regbl_reference;
-        std::ifstream regbl_surface;
         std::ifstream regbl_deduce;
 
-        /* check path specification */
-        if ( regbl_storage_path == NULL ) {
+        /* check reference date */
+        if ( regbl_store.st_reference[regbl_building] == LC_STORE_NONE ) {
 
-            /* display message */
-            std::cerr << "error : storage path specification" << std::endl;
+            /* assign no reference flag */
+            regbl_ryear = "NO_REF";
 
-            /* send message */
-            return( 1 );
+        } else {
+
+            /* import reference date */
+            regbl_ryear = std::to_string( regbl_store.st_reference[regbl_building] );
 
         }
 
-        /* check path specification */
-        if ( regbl_building_id == NULL ) {
+        /* create deduction stream */
+        regbl_deduce.open( regbl_export_deduce + "/" + regbl_egid, std::ifstream::in );
+
+        /* check deduction stream */
+        if ( regbl_deduce.is_open() == false ) {
 
             /* display message */
-            std::cerr << "error : building EGID specification" << std::endl;
+            std::cerr << "error : unable to import building deduced range" << std::endl;
 
             /* send message */
-            return( 1 );
+            return( false );
+
+        } else {
+
+            /* import deduced range */
+            regbl_deduce >> regbl_udeduce >> regbl_ldeduce;
+
+            /* delete deduction stream */
+            regbl_deduce.close();
 
         }
 
-        /* check path specification */
-        if ( regbl_output_path == NULL ) {
+        /* import surface value */
+        regbl_area = regbl_store.st_surface[regbl_building];
+
+        /* create input stream */
+        regbl_input.open( regbl_export_detect + "/" + regbl_egid, std::ifstream::in );
+
+        /* check input stream */
+        if ( regbl_input.is_open() == false ) {
 
             /* display message */
-            std::cerr << "error : exportation path specification" << std::endl;
+            std::cerr << "error : unable to locate deduction file" << std::endl;
 
             /* send message */
-            return( 1 );
+            return( false );
 
         }
 
-        /* import storage list */
-        regbl_list = lc_list_import( std::string( regbl_storage_path ) + "/regbl_list" );
+        /* input stream parsing */
+        while ( regbl_input >> regbl_year >> regbl_flag >> regbl_detx >> regbl_dety >> regbl_size ) {
 
-        /* check storage list */
-        if ( regbl_list.size() == 0 ) {
+            /* check year consistency */
+            if ( ( regbl_index >= regbl_store.st_years ) || ( std::stoi( regbl_year ) != regbl_store.st_year[regbl_index] ) ) {
 
-            /* display message */
-            std::cerr << "error : unable to import storage list file" << std::endl;
+                /* display message */
+                std::cerr << "error : inconsistency between detection file and building store" << std::endl;
 
-            /* send message */
-            return( 1 );
+                /* send message */
+                return( false );
 
-        }
+            }
 
-        /* compose path */
-        regbl_export_position = std::string( regbl_storage_path ) + "/regbl_output/output_position";
+            /* retrieve building points */
+            regbl_point = lc_store_get_position( regbl_store, regbl_index, regbl_building );
 
-        /* check consistency */
-        if ( std::filesystem::is_directory( regbl_export_position ) == false ) {
+            /* import position */
+            regbl_posx = regbl_point[0];
+            regbl_posy = regbl_point[1];
 
-            /* display message */
-            std::cerr << "error : unable to locate position directory" << std::endl;
+            /* compute metric factor */
+            regbl_factor = lc_list_metric_to_pixel( regbl_list, regbl_index );
 
-            /* send message */
-            return( 1 );
+            /* compose cropping coordinates */
+            regbl_clx = std::round( regbl_posx ) - REGBL_TRACKER_CROPHALF;
+            regbl_chx = std::round( regbl_posx ) + REGBL_TRACKER_CROPHALF;
+            regbl_cly = std::round( regbl_posy ) - REGBL_TRACKER_CROPHALF;
+            regbl_chy = std::round( regbl_posy ) + REGBL_TRACKER_CROPHALF;
 
-        }
+            /* assume center position */
+            regbl_cnx = REGBL_TRACKER_CROPHALF;
+            regbl_cny = REGBL_TRACKER_CROPHALF;
 
-        /* compose path */
-        regbl_export_detect = std::string( regbl_storage_path ) + "/regbl_output/output_detect";
+            /* edge detection */
+            if ( regbl_clx < 0 ) {
 
-        /* check consistency */
-        if ( std::filesystem::is_directory( regbl_export_detect ) == false ) {
+                /* update center position */
+                regbl_cnx += regbl_clx;
 
-            /* display message */
-            std::cerr << "error : unable to locate detection directory" << std::endl;
+                /* update crop coordinate */
+                regbl_clx = 0;
 
-            /* send message */
-            return( 1 );
+            }
 
-        }
+            /* edge detection */
+            if ( regbl_cly < 0 ) {
 
-        /* compose path */
-        regbl_export_reference = std::string( regbl_storage_path ) + "/regbl_output/output_reference";
+                /* update center position */
+                regbl_cny += regbl_cly;
 
-        /* check consistency */
-        if ( std::filesystem::is_directory( regbl_export_reference ) == false ) {
+                /* update crop coordinate */
+                regbl_cly = 0;
 
-            /* display message */
-            std::cerr << "error : unable to locate reference directory" << std::endl;
+            }
 
-            /* send message */
-            return( 1 );
+            /* edge detection */
+            if ( regbl_chx > regbl_list[regbl_index].fr_width ) {
 
-        }
+                /* update crop coordinates */
+                regbl_chx = regbl_list[regbl_index].fr_width;
 
-        /* compose path */
-        regbl_export_deduce = std::string( regbl_storage_path ) + "/regbl_output/output_deduce";
+            }
 
-        /* check consistency */
-        if ( std::filesystem::is_directory( regbl_export_deduce ) == false ) {
+            /* edge detection */
+            if ( regbl_chy > regbl_list[regbl_index].fr_height ) {
 
-            /* display message */
-            std::cerr << "error : unable to locate deduction directory" << std::endl;
+                /* update crop coordinates */
+                regbl_chy = regbl_list[regbl_index].fr_height;
 
-            /* send message */
-            return( 1 );
+            }
+            
+            /* import original map - provided maps in batch mode */
+            regbl_load = ( regbl_original.empty() == true ) ? cv::imread( regbl_storage_path + "/regbl_frame/frame_original/" + regbl_year + ".tif", cv::IMREAD_COLOR ) : regbl_original[regbl_index];
 
-        }
+            /* check importation */
+            if ( regbl_load.empty() == true ) {
 
-        /* create reference stream */
-        regbl_reference.open( regbl_export_reference + "/" + std::string( regbl_building_id ), std::ifstream::in );
+                /* display message */
+                std::cerr << "error : unable to import original map" << std::endl;
 
-        /* check reference stream */
-        if ( regbl_reference.is_open() == false ) {
+                /* send message */
+                return( false );
 
-            /* assign no reference flag */
-            regbl_ryear = "NO_REF";
+            }
 
-        } else {
+            /* crop original map - copied to keep the map untouched */
+            regbl_crop = regbl_load( cv::Rect( regbl_clx, regbl_cly, regbl_chx - regbl_clx, regbl_chy - regbl_cly ) ).clone();
 
-            /* import reference date */
-            regbl_reference >> regbl_ryear;
+            /* process crop */
+            regbl_tracker_crop( regbl_crop, regbl_cnx, regbl_cny, regbl_flag );
 
-            /* delete reference stream */
-            regbl_reference.close();
+            /* draw building and entries */
+            regbl_tracker_building( regbl_crop, regbl_cnx, regbl_cny, regbl_point, lc_store_get_count( regbl_store, regbl_building ) );
 
-        }
+            /* draw building surface */
+            regbl_tracker_surface( regbl_crop, regbl_cnx, regbl_cny, regbl_area * regbl_factor );
 
-        /* create deduction stream */
-        regbl_deduce.open( regbl_export_deduce + "/" + std::string( regbl_building_id ), std::ifstream::in );
+            /* display detection information */
+            regbl_tracker_detect( regbl_crop, regbl_cnx + ( regbl_detx - regbl_posx ), regbl_cny + ( regbl_dety - regbl_posy ), regbl_size, regbl_flag );
 
-        /* check deduction stream */
-        if ( regbl_deduce.is_open() == false ) {
+            /* check accumulator state */
+            if ( regbl_ftln.empty() == true ) {
 
-            /* display message */
-            std::cerr << "error : unable to import building deduced range" << std::endl;
+                /* bootstrap accumulator */
+                regbl_ftln = regbl_crop;
 
-            /* send message */
-            return( 1 );
+            } else {
 
-        } else {
+                /* update accumulator */
+                cv::hconcat( regbl_crop, regbl_ftln, regbl_ftln );
 
-            /* import deduced range */
-            regbl_deduce >> regbl_udeduce >> regbl_ldeduce;
+            }
 
-            /* delete deduction stream */
-            regbl_deduce.close();
+            /* import segmented map - provided maps in batch mode */
+            regbl_load = ( regbl_segmented.empty() == true ) ? cv::imread( regbl_storage_path + "/regbl_frame/frame/" + regbl_year + ".tif", cv::IMREAD_COLOR ) : regbl_segmented[regbl_index];
 
-        }
+            /* check importation */
+            if ( regbl_load.empty() == true ) {
 
-        /* create surface stream */
-        regbl_surface.open( std::string( regbl_storage_path ) + "/regbl_output/output_surface/" + std::string( regbl_building_id ), std::ifstream::in );
+                /* display message */
+                std::cerr << "error : unable to import segmented map" << std::endl;
 
-        /* check input stream */
-        if ( regbl_surface.is_open() == false ) {
+                /* send message */
+                return( false );
 
-            /* display warning */
-            std::cerr << "warning : building surface file not found : surface not displayed" << std::endl;
+            }
 
-        } else {
+            /* crop segmented map - copied to keep the map untouched */
+            regbl_crop = regbl_load( cv::Rect( regbl_clx, regbl_cly, regbl_chx - regbl_clx, regbl_chy - regbl_cly ) ).clone();
 
-            /* import surface value */
-            regbl_surface >> regbl_area;
+            /* process crop */
+            regbl_tracker_crop( regbl_crop, regbl_cnx, regbl_cny, regbl_flag );
 
-            /* delete surface stream */
-            regbl_surface.close();
+            /* draw building and entries */
+            regbl_tracker_building( regbl_crop, regbl_cnx, regbl_cny, regbl_point, lc_store_get_count( regbl_store, regbl_building ) );
 
-        }
+            /* draw building surface */
+            regbl_tracker_surface( regbl_crop, regbl_cnx, regbl_cny, regbl_area * regbl_factor );
 
-        /* create input stream */
-        regbl_input.open( regbl_export_detect + "/" + std::string( regbl_building_id ), std::ifstream::in );
+            /* display detection information */
+            regbl_tracker_detect( regbl_crop, regbl_cnx + ( regbl_detx - regbl_posx ), regbl_cny + ( regbl_dety - regbl_posy ), regbl_size, regbl_flag );
 
-        /* check input stream */
-        if ( regbl_input.is_open() == false ) {
+            /* check accumulator state */
+            if ( regbl_stln.empty() == true ) {
 
-            /* display message */
-            std::cerr << "error : unable to locate deduction file" << std::endl;
+                /* bootstrap accumulator */
+                regbl_stln = regbl_crop;
 
-            /* send message */
-            return( 1 );
+            } else {
+
+                /* update accumulator */
+                cv::hconcat( regbl_crop, regbl_stln, regbl_stln );
+
+            }
+
+            /* create timeline */
+            regbl_crop = regbl_tracker_timeline( regbl_crop.cols, regbl_year, regbl_flag );
+
+            /* check accumulator state */
+            if ( regbl_alin.empty() == true ) {
+
+                /* bootstrap accumulator */
+                regbl_alin = regbl_crop;
+
+            } else {
+
+                /* update accumulator */
+                cv::hconcat( regbl_crop, regbl_alin, regbl_alin );
+
+            }
+
+            /* create detection zone */
+            regbl_crop = regbl_tracker_detection( regbl_crop.cols, regbl_year, regbl_udeduce );
+
+            /* check accumulator state */
+            if ( regbl_adet.empty() == true ) {
+
+                /* bootstrap accumulator */
+                regbl_adet = regbl_crop;
+
+            } else {
+
+                /* update accumulator */
+                cv::hconcat( regbl_crop, regbl_adet, regbl_adet );
+
+            }
+
+            /* update index */
+            regbl_index ++;
 
         }
 
-        /* input stream parsing */
-        while ( regbl_input >> regbl_year >> regbl_flag >> regbl_detx >> regbl_dety >> regbl_size ) {
+        /* delete input stream */
+        regbl_input.close();
+
+        /* compose reference bar */
+        regbl_aref = regbl_tracker_reference( regbl_ftln.cols, regbl_egid, regbl_ryear, regbl_udeduce, regbl_ldeduce );
+
+        /* compose single representation */
+        cv::vconcat( regbl_aref, regbl_ftln, regbl_aref );
+        cv::vconcat( regbl_aref, regbl_alin, regbl_aref );
+        cv::vconcat( regbl_aref, regbl_stln, regbl_aref );
+        cv::vconcat( regbl_aref, regbl_adet, regbl_aref );
+
+        /* export result */
+        cv::imwrite( regbl_output_path + "/" + regbl_egid + ".png", regbl_aref );
+
+        /* send message */
+        return( true );
+
+    }
+
+    bool regbl_tracker_import( std::string regbl_storage_path, lc_list_t & regbl_list, std::vector< cv::Mat > & regbl_original, std::vector< cv::Mat > & regbl_segmented ) {
+
+        /* parsing storage list */
+        for ( lc_frame_t const & regbl_frame : regbl_list ) {
 
-            /* create position stream */
-            regbl_position.open( regbl_export_position + "/" + regbl_year + "/" + std::string( regbl_building_id ), std::ifstream::in );
+            /* import original map */
+            regbl_original.push_back( cv::imread( regbl_storage_path + "/regbl_frame/frame_original/" + regbl_frame.fr_name + ".tif", cv::IMREAD_COLOR ) );
 
-            /* check position stream */
-            if ( regbl_position.is_open() == false ) {
+            /* check importation */
+            if ( regbl_original.back().empty() == true ) {
 
                 /* display message */
-                std::cerr << "error : unable to access position file" << std::endl;
+                std::cerr << "error : unable to import original map" << std::endl;
 
                 /* send message */
-                return( 1 );
+                return( false );
 
             }
 
-            /* import position */
-            if ( regbl_position >> regbl_posx >> regbl_posy ) {
+            /* import segmented map */
+            regbl_segmented.push_back( cv::imread( regbl_storage_path + "/regbl_frame/frame/" + regbl_frame.fr_name + ".tif", cv::IMREAD_COLOR ) );
 
-                /* compute metric factor */
-                regbl_factor = lc_list_metric_to_pixel( regbl_list, regbl_index );
+            /* check importation */
+            if ( regbl_segmented.back().empty() == true ) {
 
-                /* invert y coordinate */
-                regbl_posy = std::stod( regbl_list[regbl_index][6] ) - regbl_posy - 1;
-                regbl_dety = std::stod( regbl_list[regbl_index][6] ) - regbl_dety - 1;
+                /* display message */
+                std::cerr << "error : unable to import segmented map" << std::endl;
 
-                /* compose cropping coordinates */
-                regbl_clx = std::round( regbl_posx ) - REGBL_TRACKER_CROPHALF;
-                regbl_chx = std::round( regbl_posx ) + REGBL_TRACKER_CROPHALF;
-                regbl_cly = std::round( regbl_posy ) - REGBL_TRACKER_CROPHALF;
-                regbl_chy = std::round( regbl_posy ) + REGBL_TRACKER_CROPHALF;
+                /* send message */
+                return( false );
 
-                /* assume center position */
-                regbl_cnx = REGBL_TRACKER_CROPHALF;
-                regbl_cny = REGBL_TRACKER_CROPHALF;
+            }
 
-                /* edge detection */
-                if ( regbl_clx < 0 ) {
+        }
 
-                    /* update center position */
-                    regbl_cnx += regbl_clx;
+        /* send message */
+        return( true );
 
-                    /* update crop coordinate */
-                    regbl_clx = 0;
+    }
 
-                }
+/*
+    source - Main function
+ */
 
-                /* edge detection */
-                if ( regbl_cly < 0 ) {
+    int main( int argc, char ** argv ) {
 
-                    /* update center position */
-                    regbl_cny += regbl_cly;
+        /* storage structure path */
+        char * regbl_storage_path( lc_read_string( argc, argv, "--storage", "-s" ) );
 
-                    /* update crop coordinate */
-                    regbl_cly = 0;
+        /* building identifier (EGID) */
+        char * regbl_building_id( lc_read_string( argc, argv, "--egid", "-g" ) );
 
-                }
+        /* exportation directory */
+        char * regbl_output_path( lc_read_string( argc, argv, "--export", "-e" ) );
 
-                /* edge detection */
-                if ( regbl_chx > std::stod( regbl_list[regbl_index][5] ) ) {
+        /* batch flag */
+        bool regbl_batch( lc_read_flag( argc, argv, "--batch", "-b" ) );
 
-                    /* update crop coordinates */
-                    regbl_chx = std::stod( regbl_list[regbl_index][5] );
+        /* buildings shard */
+        lc_shard_t regbl_shard;
 
-                }
+        /* storage list */
+        lc_list_t regbl_list;
 
-                /* edge detection */
-                if ( regbl_chy > std::stod( regbl_list[regbl_index][6] ) ) {
+        /* building store */
+        lc_store_t regbl_store;
 
-                    /* update crop coordinates */
-                    regbl_chy = std::stod( regbl_list[regbl_index][6] );
+        /* building store index */
+        int64_t regbl_building( -1 );
 
-                }
-                
-                /* import original map */
-                regbl_load = cv::imread( std::string( regbl_storage_path ) + "/regbl_frame/frame_original/" + regbl_year + ".tif", cv::IMREAD_COLOR );
+        /* batch maps */
+        std::vector< cv::Mat > regbl_original;
+        std::vector< cv::Mat > regbl_segmented;
 
-                /* check importation */
-                if ( regbl_load.empty() == true ) {
+        /* batch failure count */
+        int regbl_fail( 0 );
 
-                    /* display message */
-                    std::cerr << "error : unable to import original map" << std::endl;
+        /* check path specification */
+        if ( regbl_storage_path == NULL ) {
 
-                    /* send message */
-                    return( 1 );
+            /* display message */
+            std::cerr << "error : storage path specification" << std::endl;
 
-                }
+            /* send message */
+            return( 1 );
+
+        }
+
+        /* check path specification */
+        if ( ( regbl_building_id == NULL ) && ( regbl_batch == false ) ) {
+
+            /* display message */
+            std::cerr << "error : building EGID specification" << std::endl;
+
+            /* send message */
+            return( 1 );
+
+        }
+
+        /* check path specification */
+        if ( regbl_output_path == NULL ) {
 
-                /* crop original map */
-                regbl_crop = regbl_load( cv::Rect( regbl_clx, regbl_cly, regbl_chx - regbl_clx, regbl_chy - regbl_cly ) );
+            /* display message */
+            std::cerr << "error : exportation path specification" << std::endl;
 
-                /* process crop */
-                regbl_tracker_crop( regbl_crop, regbl_cnx, regbl_cny, regbl_flag );
+            /* send message */
+            return( 1 );
 
-                /* draw building and entries */
-                regbl_tracker_building( regbl_crop, regbl_cnx, regbl_cny, regbl_position );
+        }
 
-                /* draw building surface */
-                regbl_tracker_surface( regbl_crop, regbl_cnx, regbl_cny, regbl_area * regbl_factor );
+        /* read shard specification */
+        if ( lc_shard_read( argc, argv, "--shard", "-p", regbl_shard ) == false ) {
 
-                /* display detection information */
-                regbl_tracker_detect( regbl_crop, regbl_cnx + ( regbl_detx - regbl_posx ), regbl_cny + ( regbl_dety - regbl_posy ), regbl_size, regbl_flag );
+            /* display message */
+            std::cerr << "error : invalid shard specification" << std::endl;
 
-                /* check accumulator state */
-                if ( regbl_ftln.empty() == true ) {
+            /* send message */
+            return( 1 );
 
-                    /* bootstrap accumulator */
-                    regbl_ftln = regbl_crop;
+        }
 
-                } else {
+        /* import storage list */
+        regbl_list = lc_list_import( std::string( regbl_storage_path ) + "/regbl_list" );
 
-                    /* update accumulator */
-                    cv::hconcat( regbl_crop, regbl_ftln, regbl_ftln );
+        /* check storage list */
+        if ( regbl_list.size() == 0 ) {
 
-                }
+            /* display message */
+            std::cerr << "error : unable to import storage list file" << std::endl;
 
-                /* import segmented map */
-                regbl_load = cv::imread( std::string( regbl_storage_path ) + "/regbl_frame/frame/" + regbl_year + ".tif", cv::IMREAD_COLOR );
+            /* send message */
+            return( 1 );
 
-                /* check importation */
-                if ( regbl_load.empty() == true ) {
+        }
 
-                    /* display message */
-                    std::cerr << "error : unable to import segmented map" << std::endl;
+        /* import building store */
+        if ( lc_store_open( std::string( regbl_storage_path ) + "/regbl_output/output_store", regbl_store ) == false ) {
 
-                    /* send message */
-                    return( 1 );
+            /* display message */
+            std::cerr << "error : unable to import building store" << std::endl;
 
-                }
+            /* send message */
+            return( 1 );
+
+        }
 
-                /* crop segmented map */
-                regbl_crop = regbl_load( cv::Rect( regbl_clx, regbl_cly, regbl_chx - regbl_clx, regbl_chy - regbl_cly ) );
+        /* check store and list consistency */
+        if ( lc_store_check( regbl_store, regbl_list ) == false ) {
 
-                /* process crop */
-                regbl_tracker_crop( regbl_crop, regbl_cnx, regbl_cny, regbl_flag );
+            /* display message */
+            std::cerr << "error : inconsistency between building store and storage list" << std::endl;
 
-                /* draw building and entries */
-                regbl_tracker_building( regbl_crop, regbl_cnx, regbl_cny, regbl_position );
+            /* send message */
+            return( 1 );
 
-                /* draw building surface */
-                regbl_tracker_surface( regbl_crop, regbl_cnx, regbl_cny, regbl_area * regbl_factor );
+        }
 
-                /* display detection information */
-                regbl_tracker_detect( regbl_crop, regbl_cnx + ( regbl_detx - regbl_posx ), regbl_cny + ( regbl_dety - regbl_posy ), regbl_size, regbl_flag );
+        /* check consistency */
+        if ( std::filesystem::is_directory( std::string( regbl_storage_path ) + "/regbl_output/output_detect" ) == false ) {
+
+            /* display message */
+            std::cerr << "error : unable to locate detection directory" << std::endl;
 
-                /* check accumulator state */
-                if ( regbl_stln.empty() == true ) {
+            /* send message */
+            return( 1 );
 
-                    /* bootstrap accumulator */
-                    regbl_stln = regbl_crop;
+        }
 
-                } else {
+        /* check consistency */
+        if ( std::filesystem::is_directory( std::string( regbl_storage_path ) + "/regbl_output/output_deduce" ) == false ) {
 
-                    /* update accumulator */
-                    cv::hconcat( regbl_crop, regbl_stln, regbl_stln );
+            /* display message */
+            std::cerr << "error : unable to locate deduction directory" << std::endl;
 
-                }
+            /* send message */
+            return( 1 );
 
-                /* create timeline */
-                regbl_crop = regbl_tracker_timeline( regbl_crop.cols, regbl_year, regbl_flag );
+        }
 
-                /* check accumulator state */
-                if ( regbl_alin.empty() == true ) {
+        /* check batch mode */
+        if ( regbl_batch == true ) {
 
-                    /* bootstrap accumulator */
-                    regbl_alin = regbl_crop;
+            /* import maps once for all buildings */
+            if ( regbl_tracker_import( regbl_storage_path, regbl_list, regbl_original, regbl_segmented ) == false ) {
 
-                } else {
+                /* send message */
+                return( 1 );
 
-                    /* update accumulator */
-                    cv::hconcat( regbl_crop, regbl_alin, regbl_alin );
+            }
 
-                }
+            /* parsing store buildings - hilbert order for map locality */
+            for ( uint64_t regbl_parse = 0; regbl_parse < regbl_store.st_count; regbl_parse ++ ) {
 
-                /* create detection zone */
-                regbl_crop = regbl_tracker_detection( regbl_crop.cols, regbl_year, regbl_udeduce );
+                /* retrieve building index */
+                regbl_building = regbl_store.st_order[regbl_parse];
 
-                /* check accumulator state */
-                if ( regbl_adet.empty() == true ) {
+                /* check building shard */
+                if ( lc_shard_member( regbl_shard, regbl_store.st_egid[regbl_building] ) == false ) continue;
 
-                    /* bootstrap accumulator */
-                    regbl_adet = regbl_crop;
+                /* compute building timeline */
+                if ( regbl_tracker_export( regbl_storage_path, regbl_list, regbl_store, regbl_building, regbl_original, regbl_segmented, regbl_output_path ) == false ) {
 
-                } else {
+                    /* display message */
+                    std::cerr << "error : unable to compute timeline of building " << regbl_store.st_egid[regbl_building] << std::endl;
 
-                    /* update accumulator */
-                    cv::hconcat( regbl_crop, regbl_adet, regbl_adet );
+                    /* update failure count */
+                    regbl_fail ++;
 
                 }
 
+            }
 
-            } else {
+        } else {
+
+            /* search building in store */
+            if ( ( regbl_building = lc_store_find( regbl_store, std::strtoll( regbl_building_id, NULL, 10 ) ) ) < 0 ) {
 
                 /* display message */
-                std::cerr << "error : unable to import building position from file" << std::endl;
+                std::cerr << "error : unable to locate building in store" << std::endl;
 
                 /* send message */
                 return( 1 );
 
             }
 
-            /* close position stream */
-            regbl_position.close();
+            /* compute building timeline */
+            if ( regbl_tracker_export( regbl_storage_path, regbl_list, regbl_store, regbl_building, regbl_original, regbl_segmented, regbl_output_path ) == false ) {
 
-            /* update index */
-            regbl_index ++;
-
-        }
+                /* update failure count */
+                regbl_fail ++;
 
-        /* delete input stream */
-        regbl_input.close();
-
-        /* compose reference bar */
-        regbl_aref = regbl_tracker_reference( regbl_ftln.cols, std::string( regbl_building_id ), regbl_ryear, regbl_udeduce, regbl_ldeduce );
+            }
 
-        /* compose single representation */
-        cv::vconcat( regbl_aref, regbl_ftln, regbl_aref );
-        cv::vconcat( regbl_aref, regbl_alin, regbl_aref );
-        cv::vconcat( regbl_aref, regbl_stln, regbl_aref );
-        cv::vconcat( regbl_aref, regbl_adet, regbl_aref );
+        }
 
-        /* export result */
-        cv::imwrite( std::string( regbl_output_path ) + "/" + std::string( regbl_building_id ) + ".png", regbl_aref );
+        /* release building store */
+        lc_store_close( regbl_store );
 
         /* send message */
-        return( 0 );
+        return( ( regbl_fail > 0 ) ? 1 : 0 );
 
     }
-
@@ -56,6 +56,8 @@
     # include <string>
     # include <fstream>
     # include <filesystem>
+    # include <vector>
+    # include <cstdint>
     # include <common-include.hpp>
     # include <opencv2/core/core.hpp>
     # include <opencv2/highgui/highgui.hpp>
@@ -109,13 +111,18 @@
      * As these information are extracted from the RegBL database, they are
      * rendered in pink.
      *
-     * \param regbl_crop   Building map crop
-     * \param regbl_cnx    Building pixel position
-     * \param regbl_cny    Building pixel position
-     * \param regbl_stream Building position file path
+     * The positions are read from the building store, the first point being
+     * the position of the building and the following ones the position of its
+     * entries.
+     *
+     * \param regbl_crop  Building map crop
+     * \param regbl_cnx   Building pixel position
+     * \param regbl_cny   Building pixel position
+     * \param regbl_point Building points, as (x, y) pairs
+     * \param regbl_count Building points count
      */
 
-    void regbl_tracker_building( cv::Mat & regbl_crop, int const regbl_cnx, int const regbl_cny, std::ifstream & regbl_stream );
+    void regbl_tracker_building( cv::Mat & regbl_crop, int const regbl_cnx, int const regbl_cny, int32_t const * const regbl_point, uint64_t const regbl_count );
 
     /*! \brief Rendering methods
      * 
@@ -229,6 +236,47 @@
 
     cv::Mat regbl_tracker_reference( int const regbl_width, std::string regbl_geid, std::string regbl_year, std::string regbl_udeduce, std::string regbl_ldeduce );
 
+    /*! \brief Exportation methods
+     *
+     * This function computes the timeline of the provided building and exports
+     * it in the exportation directory, as a PNG image named after the EGID of
+     * the building. The timeline is composed as described for the main
+     * function, using the detection and deduction files of the building.
+     *
+     * The crops are taken out of the provided maps, one per year in the order
+     * of the 3D raster descriptor. If no maps are provided, the maps of each
+     * year are imported from the main storage directory. The crops are copied
+     * so that the provided maps are left untouched for the next buildings.
+     *
+     * \param regbl_storage_path Main storage path
+     * \param regbl_list         3D raster descriptor
+     * \param regbl_store        Building store
+     * \param regbl_building     Store index of the building
+     * \param regbl_original     Original maps, empty to import them
+     * \param regbl_segmented    Pre-processed maps, empty to import them
+     * \param regbl_output_path  Exportation directory path
+     *
+     * \return Returns true on success, false otherwise
+     */
+
+    bool regbl_tracker_export( std::string regbl_storage_path, lc_list_t & regbl_list, lc_store_t & regbl_store, int64_t const regbl_building, std::vector< cv::Mat > const & regbl_original, std::vector< cv::Mat > const & regbl_segmented, std::string regbl_output_path );
+
+    /*! \brief Exportation methods
+     *
+     * This function imports the original and pre-processed maps of each year
+     * of the 3D raster descriptor, in its order. It is used by the batch mode
+     * to import the maps once for all the buildings.
+     *
+     * \param regbl_storage_path Main storage path
+     * \param regbl_list         3D raster descriptor
+     * \param regbl_original     Original maps
+     * \param regbl_segmented    Pre-processed maps
+     *
+     * \return Returns true on success, false otherwise
+     */
+
+    bool regbl_tracker_import( std::string regbl_storage_path, lc_list_t & regbl_list, std::vector< cv::Mat > & regbl_original, std::vector< cv::Mat > & regbl_segmented );
+
     /*! \brief Main function
      *
      * This program is used to create a timeline focusing on one building and
@@ -238,9 +286,13 @@
      *     ./regbl_tracker --storage/-s path of the main storage directory
      *                     --egid/-g building EGID
      *                     --export/-e Exportation directory path
+     *                     --batch/-b Timelines of all the store buildings
+     *                     --shard/-p Buildings shard (i/n), in batch mode
      *
-     * The main function starts by extracting crops, centred around the desired
-     * building, from the pre-processed maps and the original one.
+     * The main function starts by searching the building in the building store
+     * to retrieve its positions, surface and construction date. It then
+     * extracts crops, centred around the desired building, from the
+     * pre-processed maps and the original one.
      *
      * In parallel, the program creates three indicator, on top, between the
      * pre-processed and original map crops succession and on bottom of the
@@ -264,6 +316,15 @@
      * path and uses the EGID of the building to name the image file. The PNG
      * format is considered to export the timeline.
      *
+     * In batch mode, the timelines of all the buildings of the store are
+     * computed, the maps being imported once and kept in memory. The buildings
+     * are processed following the Hilbert order of the building store, so
+     * that consecutive crops are taken out of neighbouring parts of the maps.
+     * With the shard specification, only the buildings of the shard i over n
+     * are considered (see the lc_shard_t structure). As the timelines are
+     * named after the EGID of their building, the shards can share the
+     * exportation directory and need no merge.
+     *
      * \param argc Standard parameter
      * \param argv Standard parameter
      *